@@ -0,0 +1,132 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+
+using namespace Gecode;
+
+/**
+ * \brief %Example: Random tables for benchmarking compact-table propagation
+ *
+ * The model consists of extensional constraints on all cyclic windows
+ * of consecutive variables, each defined by a large table of random
+ * tuples (the size of the tables is given by the size option). Hence,
+ * nearly all propagation time is spent in the compact-table propagator
+ * and the search finds only few or no solutions.
+ *
+ * The model options select which instruction set extensions are used
+ * for the bit-set operations of the propagator.
+ *
+ * \ingroup Example
+ *
+ */
+class CompactTable : public Script {
+private:
+  /// Number of variables
+  static const int n = 12;
+  /// Number of variables per table
+  static const int k = 6;
+  /// Size of variable domains
+  static const int d = 10;
+  /// Variables
+  IntVarArray x;
+public:
+  /// Instruction set extensions to use
+  enum {
+    MODEL_AVX512, ///< Use AVX-512 if available
+    MODEL_AVX2,   ///< Use AVX2 if available
+    MODEL_SCALAR  ///< Use scalar instructions only
+  };
+  /// The actual problem
+  CompactTable(const SizeOptions& opt)
+    : Script(opt), x(*this,n,0,d-1) {
+    Rnd r(opt.seed());
+    // Post tables on all cyclic windows of variables
+    for (int o=0; o<n; o++) {
+      TupleSet ts(k);
+      IntArgs t(k);
+      for (unsigned int i=0; i<opt.size(); i++) {
+        for (int j=0; j<k; j++)
+          t[j] = static_cast<int>(r(d));
+        ts.add(t);
+      }
+      ts.finalize();
+      IntVarArgs y(k);
+      for (int j=0; j<k; j++)
+        y[j] = x[(o+j) % n];
+      extensional(*this, y, ts);
+    }
+    branch(*this, x, INT_VAR_SIZE_MIN(), INT_VAL_MIN());
+  }
+
+  /// Constructor for cloning \a s
+  CompactTable(CompactTable& s) : Script(s) {
+    x.update(*this, s.x);
+  }
+  /// Perform copying during cloning
+  virtual Space*
+  copy(void) {
+    return new CompactTable(*this);
+  }
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    os << "\tx[] = " << x << std::endl;
+  }
+
+};
+
+/** \brief Main-function
+ *  \relates CompactTable
+ */
+int
+main(int argc, char* argv[]) {
+  SizeOptions opt("CompactTable");
+  opt.size(100000);
+  opt.solutions(0);
+  opt.model(CompactTable::MODEL_AVX512);
+  opt.model(CompactTable::MODEL_AVX512, "avx512",
+            "use AVX-512 instructions if available");
+  opt.model(CompactTable::MODEL_AVX2, "avx2",
+            "use at most AVX2 instructions");
+  opt.model(CompactTable::MODEL_SCALAR, "scalar",
+            "use scalar instructions only");
+  opt.parse(argc,argv);
+  switch (opt.model()) {
+  case CompactTable::MODEL_AVX2:
+    Support::simd(Support::SIMD_AVX2); break;
+  case CompactTable::MODEL_SCALAR:
+    Support::simd(Support::SIMD_NONE); break;
+  default:
+    Support::simd(Support::SIMD_AVX512); break;
+  }
+  Script::run<CompactTable,DFS,SizeOptions>(opt);
+  return 0;
+}
+
+// STATISTICS: example-any
@@ -1512,6 +1512,20 @@ AC_DEFUN([AC_GECODE_THREADS],[
   fi
 ])
 
+AC_DEFUN([AC_GECODE_PROCESSES],[
+  AC_MSG_CHECKING(whether worker processes can be created)
+  AC_TRY_LINK([#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/wait.h>],
+    [int sv[2]; (void) socketpair(AF_UNIX,SOCK_STREAM,0,sv);
+     (void) waitpid(fork(),0,0);],
+    [AC_MSG_RESULT(yes)
+     AC_DEFINE(GECODE_HAS_PROCESSES,1,
+       [Whether worker processes can be created (by fork)])],
+    [AC_MSG_RESULT(no)])
+])
+
 AC_DEFUN([AC_GECODE_TIMER],[
   AC_CHECK_HEADER(sys/time.h,
   [AC_DEFINE(GECODE_USE_GETTIMEOFDAY,1,[Use gettimeofday for time-measurement])],
@@ -375,6 +375,7 @@ namespace Gecode {
     Driver::DoubleOption      _decay;       ///< Decay option
     Driver::UnsignedIntOption _seed;        ///< Seed option
     Driver::DoubleOption      _step;        ///< Step option
+    Driver::BoolOption        _feedback;    ///< Whether to schedule by learned cost
     //@}
 
     /// \name Search options
@@ -408,6 +409,7 @@ namespace Gecode {
     Driver::StringValueOption _out_file;      ///< Where to print solutions
     Driver::StringValueOption _log_file;      ///< Where to print statistics
     Driver::TraceOption       _trace;         ///< Trace flags for tracing
+    Driver::StringValueOption _profile;       ///< Where to print propagator profile
 
 #ifdef GECODE_HAS_CPPROFILER
     Driver::IntOption         _profiler_id;   ///< Use this execution id for the CP-profiler
@@ -470,6 +472,11 @@ namespace Gecode {
     void step(double s);
     /// Return step value
     double step(void) const;
+
+    /// Set default whether propagators are scheduled by learned cost
+    void feedback(bool b);
+    /// Return whether propagators are scheduled by learned cost
+    bool feedback(void) const;
     //@}
 
     /// \name Search options
@@ -599,6 +606,11 @@ namespace Gecode {
     /// Get file name for Gecode stats
     const char* log_file(void) const;
 
+    /// Set file name for propagator profile
+    void profile(const char* f);
+    /// Get file name for propagator profile (NULL if none)
+    const char* profile(void) const;
+
     /// Set trace flags
     void trace(int f);
     /// Return trace flags
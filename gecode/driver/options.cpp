@@ -583,6 +583,8 @@ namespace Gecode {
       _decay("decay","decay factor",1.0),
       _seed("seed","random number generator seed",1U),
       _step("step","step distance for float optimization",0.0),
+      _feedback("feedback",
+                "whether to schedule propagators by learned cost",false),
 
       _search("search","search engine variants"),
       _solutions("solutions","number of solutions (0 = all)",1),
@@ -618,7 +620,9 @@ namespace Gecode {
                 "(supports stdout, stdlog, stderr)","stdout"),
       _log_file("file-stat", "where to print statistics "
                 "(supports stdout, stdlog, stderr)","stdout"),
-      _trace(0)
+      _trace(0),
+      _profile("profile", "where to print per-propagator profile "
+               "(JSON if ending in .json, CSV otherwise)",NULL)
 
 #ifdef GECODE_HAS_CPPROFILER
       ,
@@ -643,6 +647,7 @@ namespace Gecode {
 
     add(_model); add(_symmetry); add(_propagation); add(_ipl);
     add(_branching); add(_decay); add(_seed); add(_step);
+    add(_feedback);
     add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
     add(_d_l);
     add(_node); add(_fail); add(_time); add(_interrupt);
@@ -651,7 +656,7 @@ namespace Gecode {
     add(_nogoods); add(_nogoods_limit);
     add(_relax);
     add(_mode); add(_iterations); add(_samples); add(_print_last);
-    add(_out_file); add(_log_file); add(_trace);
+    add(_out_file); add(_log_file); add(_trace); add(_profile);
 #ifdef GECODE_HAS_CPPROFILER
     add(_profiler_id);
     add(_profiler_port);
@@ -261,6 +261,15 @@ namespace Gecode {
     return _step.value();
   }
 
+  inline void
+  Options::feedback(bool b) {
+    _feedback.value(b);
+  }
+  inline bool
+  Options::feedback(void) const {
+    return _feedback.value();
+  }
+
 
   /*
    * Search options
@@ -495,6 +504,16 @@ namespace Gecode {
     return _log_file.value();
   }
 
+  inline void
+  Options::profile(const char* f) {
+    _profile.value(f);
+  }
+
+  inline const char*
+  Options::profile(void) const {
+    return _profile.value();
+  }
+
   inline void
   Options::trace(int f) {
     _trace.value(f);
@@ -35,6 +35,8 @@
 #include <gecode/driver.hh>
 
 #include <cmath>
+#include <cstring>
+#include <fstream>
 
 namespace Gecode { namespace Driver {
 
@@ -70,6 +72,18 @@ namespace Gecode { namespace Driver {
   }
 
 
+  void
+  profile(PropagatorProfiler& p, const char* f) {
+    std::ofstream os(f);
+    if (!os.good())
+      throw Exception("Driver::profile","Could not open profile file");
+    size_t n = strlen(f);
+    if ((n >= 5) && (strcmp(f+n-5,".json") == 0))
+      p.json(os);
+    else
+      p.csv(os);
+  }
+
   double
   am(double t[], unsigned int n) {
     if (n < 1)
@@ -147,6 +147,15 @@ namespace Gecode { namespace Driver {
   GECODE_DRIVER_EXPORT double
   dev(double t[], unsigned int n);
 
+  /**
+   * \brief Print propagator profile \a p to file \a f
+   *
+   * The profile is printed as JSON if \a f ends in \c .json and as
+   * comma-separated values otherwise.
+   */
+  GECODE_DRIVER_EXPORT void
+  profile(PropagatorProfiler& p, const char* f);
+
   /// Create cutoff object from options
   template<class Options>
   inline Search::Cutoff*
@@ -227,7 +236,9 @@ namespace Gecode { namespace Driver {
   template<class BaseSpace>
   forceinline
   ScriptBase<BaseSpace>::ScriptBase(const Options& opt)
-    : BaseSpace(opt) {}
+    : BaseSpace(opt) {
+    this->feedback(opt.feedback());
+  }
 
   template<class BaseSpace>
   forceinline
@@ -369,6 +380,11 @@ namespace Gecode { namespace Driver {
             s = new Script(o);
           unsigned int n_p = PropagatorGroup::all.size(*s);
           unsigned int n_b = BrancherGroup::all.size(*s);
+          PropagatorProfiler* pp = NULL;
+          if (o.profile() != NULL) {
+            pp = new PropagatorProfiler;
+            s->profile(*pp);
+          }
           so.threads = o.threads();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
@@ -444,6 +460,9 @@ namespace Gecode { namespace Driver {
                   << "\trestarts:     " << stat.restart << endl
                   << "\tno-goods:     " << stat.nogood << endl
                   << "\tpeak depth:   " << stat.depth << endl
+                  << "\tclones:       " << stat.clone << " ("
+                  << stat.propagator << " propagators, "
+                  << stat.brancher << " branchers copied)" << endl
 #ifdef GECODE_PEAKHEAP
                   << "\tpeak memory:  "
                   << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
@@ -451,6 +470,10 @@ namespace Gecode { namespace Driver {
 #endif
                   << endl;
           }
+          if (pp != NULL) {
+            profile(*pp,o.profile());
+            delete pp;
+          }
           delete so.stop;
           delete so.tracer;
         }
@@ -465,6 +488,11 @@ namespace Gecode { namespace Driver {
             s = new Script(o);
           unsigned int n_p = PropagatorGroup::all.size(*s);
           unsigned int n_b = BrancherGroup::all.size(*s);
+          PropagatorProfiler* pp = NULL;
+          if (o.profile() != NULL) {
+            pp = new PropagatorProfiler;
+            s->profile(*pp);
+          }
 
           so.clone   = false;
           so.threads = o.threads();
@@ -504,6 +532,9 @@ namespace Gecode { namespace Driver {
                   << "\trestarts:     " << stat.restart << endl
                   << "\tno-goods:     " << stat.nogood << endl
                   << "\tpeak depth:   " << stat.depth << endl
+                  << "\tclones:       " << stat.clone << " ("
+                  << stat.propagator << " propagators, "
+                  << stat.brancher << " branchers copied)" << endl
 #ifdef GECODE_PEAKHEAP
                   << "\tpeak memory:  "
                   << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
@@ -511,6 +542,10 @@ namespace Gecode { namespace Driver {
 #endif
                   << endl;
           }
+          if (pp != NULL) {
+            profile(*pp,o.profile());
+            delete pp;
+          }
           delete so.stop;
         }
         break;
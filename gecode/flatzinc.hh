@@ -253,6 +253,7 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::StringOption      _mode;       ///< Script mode to run
       Gecode::Driver::BoolOption        _stat;       ///< Emit statistics
       Gecode::Driver::StringValueOption _output;     ///< Output file
+      Gecode::Driver::StringValueOption _table_cache; ///< Directory for caching tables
 
 #ifdef GECODE_HAS_CPPROFILER
 
@@ -291,7 +292,8 @@ namespace Gecode { namespace FlatZinc {
       _step("step","step distance for float optimization",0.0),
       _mode("mode","how to execute script",Gecode::SM_SOLUTION),
       _stat("s","emit statistics"),
-      _output("o","file to send output to")
+      _output("o","file to send output to"),
+      _table_cache("table-cache","directory for caching tables between runs")
 
 #ifdef GECODE_HAS_CPPROFILER
       ,
@@ -321,7 +323,7 @@ namespace Gecode { namespace FlatZinc {
       add(_restart); add(_r_base); add(_r_scale);
       add(_nogoods); add(_nogoods_limit);
       add(_mode); add(_stat);
-      add(_output);
+      add(_output); add(_table_cache);
 #ifdef GECODE_HAS_CPPROFILER
       add(_profiler_id);
       add(_profiler_port);
@@ -360,6 +362,7 @@ namespace Gecode { namespace FlatZinc {
     int seed(void) const { return _seed.value(); }
     double step(void) const { return _step.value(); }
     const char* output(void) const { return _output.value(); }
+    const char* table_cache(void) const { return _table_cache.value(); }
 
     Gecode::ScriptMode mode(void) const {
       return static_cast<Gecode::ScriptMode>(_mode.value());
@@ -528,6 +531,14 @@ namespace Gecode { namespace FlatZinc {
     /// Initialize space with given number of variables
     void init(int intVars, int boolVars, int setVars, int floatVars);
 
+    /**
+     * \brief Cache tuple sets and DFAs in directory \a dir between runs
+     *
+     * Must be called before constraints are posted. The directory must
+     * exist; entries that cannot be read or written are ignored.
+     */
+    void tableCache(const std::string& dir);
+
     /// Create new integer variable from specification
     void newIntVar(IntVarSpec* vs);
     /// Link integer variable \a iv to Boolean variable \a bv
@@ -658,6 +669,8 @@ namespace Gecode { namespace FlatZinc {
     IntPropLevel ann2ipl(AST::Node* ann);
     /// Share DFA \a a if possible
     DFA getSharedDFA(DFA& a);
+    /// Return DFA for start state \a s, transitions \a t, and final states \a f
+    DFA arg2dfa(int s, DFA::Transition t[], int f[]);
     //@}
   };
 
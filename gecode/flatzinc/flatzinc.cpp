@@ -45,7 +45,11 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <fstream>
 #include <limits>
+#include <random>
+#include <cstdio>
+#include <cstring>
 #include <unordered_set>
 
 
@@ -750,6 +754,243 @@ namespace Gecode { namespace FlatZinc {
 
 #endif
 
+  /**
+   * \brief Persistent cache of tuple sets and DFAs
+   *
+   * An entry is named after a hash of the input a table is built from
+   * and stores this input. An entry is only used if the stored input
+   * matches exactly, hence neither hash collisions nor stale entries
+   * can change a table. A tuple set entry refers to a file written by
+   * TupleSet::save. A DFA entry contains the transitions and final
+   * states of the minimized DFA, which is then constructed without
+   * minimizing it again.
+   *
+   * Files are written under a temporary name and then renamed, such
+   * that several processes can share a cache directory.
+   */
+  class TableCache {
+  protected:
+    /// Directory of the cache
+    std::string dir;
+    /// Return file name for input \a k with prefix \a p and extension \a e
+    std::string name(const char* p, const std::vector<int>& k,
+                     const char* e) const;
+    /// Return temporary file name for file \a fn
+    static std::string tmp(const std::string& fn);
+    /// Read entry \a fn into \a d and return whether it is for input \a k
+    static bool read(const std::string& fn, const std::vector<int>& k,
+                     std::vector<int>& d);
+    /// Write entry \a fn for input \a k with data \a d
+    static void write(const std::string& fn, const std::vector<int>& k,
+                      const std::vector<int>& d);
+  public:
+    /// Initialize for directory \a d
+    TableCache(const std::string& d);
+    /// Find tuple set \a ts for input \a k
+    bool get(const std::vector<int>& k, TupleSet& ts) const;
+    /// Store tuple set \a ts for input \a k
+    void put(const std::vector<int>& k, const TupleSet& ts) const;
+    /// Find DFA \a d for input \a k
+    bool get(const std::vector<int>& k, DFA& d) const;
+    /// Store DFA \a d for input \a k
+    void put(const std::vector<int>& k, const DFA& d) const;
+  };
+
+  /// Header of a table cache entry
+  class TableCacheHeader {
+  public:
+    /// Identification of cache entries
+    char magic[8];
+    /// Version of the file format
+    unsigned int version;
+    /// Number of integers of the input
+    unsigned int n_k;
+    /// Number of integers of the data
+    unsigned int n_d;
+    /// Initialize for the current file format
+    TableCacheHeader(void) : version(1U), n_k(0U), n_d(0U) {
+      std::memcpy(magic, "GecodeTC", sizeof(magic));
+    }
+  };
+
+  TableCache::TableCache(const std::string& d) : dir(d) {}
+
+  std::string
+  TableCache::name(const char* p, const std::vector<int>& k,
+                   const char* e) const {
+    // 64-bit FNV-1a hash, which does not depend on the platform
+    unsigned long long int h = 14695981039346656037ULL;
+    for (int v : k) {
+      unsigned int u = static_cast<unsigned int>(v);
+      for (int i=0; i<4; i++) {
+        h ^= (u >> (8*i)) & 0xffU;
+        h *= 1099511628211ULL;
+      }
+    }
+    char b[17];
+    std::snprintf(b, sizeof(b), "%016llx", h);
+    return dir + "/" + p + "-" + b + e;
+  }
+
+  std::string
+  TableCache::tmp(const std::string& fn) {
+    std::random_device rd;
+    return fn + ".tmp" + std::to_string(rd());
+  }
+
+  bool
+  TableCache::read(const std::string& fn, const std::vector<int>& k,
+                   std::vector<int>& d) {
+    std::ifstream f(fn.c_str(), std::ios::in | std::ios::binary);
+    if (!f.seekg(0, std::ios::end))
+      return false;
+    std::streamoff n = f.tellg();
+    TableCacheHeader e, h;
+    if ((n < static_cast<std::streamoff>(sizeof(TableCacheHeader))) ||
+        !f.seekg(0, std::ios::beg) ||
+        !f.read(reinterpret_cast<char*>(&h), sizeof(TableCacheHeader)) ||
+        (std::memcmp(e.magic, h.magic, sizeof(e.magic)) != 0) ||
+        (h.version != e.version) || (h.n_k != k.size()))
+      return false;
+    // The size of the file must match the header
+    std::size_t m = sizeof(TableCacheHeader) +
+      sizeof(int) * (static_cast<std::size_t>(h.n_k) +
+                     static_cast<std::size_t>(h.n_d));
+    if (static_cast<std::size_t>(n) != m)
+      return false;
+    std::vector<int> sk(h.n_k);
+    if ((h.n_k > 0U) &&
+        !f.read(reinterpret_cast<char*>(&sk[0]),
+                static_cast<std::streamsize>(sizeof(int) * h.n_k)))
+      return false;
+    if (sk != k)
+      return false;
+    d.resize(h.n_d);
+    if ((h.n_d > 0U) &&
+        !f.read(reinterpret_cast<char*>(&d[0]),
+                static_cast<std::streamsize>(sizeof(int) * h.n_d)))
+      return false;
+    return true;
+  }
+
+  void
+  TableCache::write(const std::string& fn, const std::vector<int>& k,
+                    const std::vector<int>& d) {
+    std::string t = tmp(fn);
+    {
+      std::ofstream f(t.c_str(), std::ios::out | std::ios::binary |
+                      std::ios::trunc);
+      TableCacheHeader h;
+      h.n_k = static_cast<unsigned int>(k.size());
+      h.n_d = static_cast<unsigned int>(d.size());
+      f.write(reinterpret_cast<const char*>(&h), sizeof(TableCacheHeader));
+      if (!k.empty())
+        f.write(reinterpret_cast<const char*>(&k[0]),
+                static_cast<std::streamsize>(sizeof(int) * k.size()));
+      if (!d.empty())
+        f.write(reinterpret_cast<const char*>(&d[0]),
+                static_cast<std::streamsize>(sizeof(int) * d.size()));
+      f.close();
+      if (!f) {
+        (void) std::remove(t.c_str());
+        return;
+      }
+    }
+    if (std::rename(t.c_str(), fn.c_str()) != 0)
+      (void) std::remove(t.c_str());
+  }
+
+  bool
+  TableCache::get(const std::vector<int>& k, TupleSet& ts) const {
+    std::vector<int> d;
+    if (!read(name("ts",k,".key"),k,d) || (d.size() != 2U))
+      return false;
+    try {
+      TupleSet l(name("ts",k,".ts"));
+      // The tuple set file must have been written for this entry
+      unsigned long long int h = static_cast<unsigned long long int>(l.hash());
+      if ((l.arity() != k[0]) ||
+          (static_cast<unsigned int>(d[0]) !=
+           static_cast<unsigned int>(h & 0xffffffffULL)) ||
+          (static_cast<unsigned int>(d[1]) !=
+           static_cast<unsigned int>(h >> 32)))
+        return false;
+      ts = l;
+    } catch (Int::InvalidTupleSetFile&) {
+      return false;
+    }
+    return true;
+  }
+
+  void
+  TableCache::put(const std::vector<int>& k, const TupleSet& ts) const {
+    std::string fn = name("ts",k,".ts");
+    std::string t = tmp(fn);
+    try {
+      ts.save(t);
+    } catch (Int::InvalidTupleSetFile&) {
+      (void) std::remove(t.c_str());
+      return;
+    }
+    if (std::rename(t.c_str(), fn.c_str()) != 0) {
+      (void) std::remove(t.c_str());
+      return;
+    }
+    unsigned long long int h = static_cast<unsigned long long int>(ts.hash());
+    std::vector<int> d(2);
+    d[0] = static_cast<int>(static_cast<unsigned int>(h & 0xffffffffULL));
+    d[1] = static_cast<int>(static_cast<unsigned int>(h >> 32));
+    write(name("ts",k,".key"),k,d);
+  }
+
+  bool
+  TableCache::get(const std::vector<int>& k, DFA& dfa) const {
+    std::vector<int> d;
+    if (!read(name("dfa",k,".dfa"),k,d) || d.empty())
+      return false;
+    // A minimized DFA has at most one state more than transitions
+    int n_trans = d[0];
+    if ((n_trans < 0) ||
+        (static_cast<std::size_t>(n_trans) > (d.size() - 1U) / 3U))
+      return false;
+    int n_finals = static_cast<int>(d.size()) - 1 - 3*n_trans;
+    Region r;
+    DFA::Transition* t = r.alloc<DFA::Transition>(n_trans+1);
+    for (int i=0; i<n_trans; i++) {
+      t[i].i_state = d[1+3*i+0];
+      t[i].symbol  = d[1+3*i+1];
+      t[i].o_state = d[1+3*i+2];
+      if ((t[i].i_state < 0) || (t[i].i_state > n_trans) ||
+          (t[i].o_state < 0) || (t[i].o_state > n_trans))
+        return false;
+    }
+    t[n_trans].i_state = -1;
+    int* f = r.alloc<int>(n_finals+1);
+    for (int i=0; i<n_finals; i++) {
+      f[i] = d[1+3*n_trans+i];
+      if ((f[i] < 0) || (f[i] > n_trans))
+        return false;
+    }
+    f[n_finals] = -1;
+    dfa = DFA(0,t,f,false);
+    return true;
+  }
+
+  void
+  TableCache::put(const std::vector<int>& k, const DFA& dfa) const {
+    std::vector<int> d;
+    d.push_back(dfa.n_transitions());
+    for (DFA::Transitions t(dfa); t(); ++t) {
+      d.push_back(t.i_state());
+      d.push_back(t.symbol());
+      d.push_back(t.o_state());
+    }
+    for (int i=dfa.final_fst(); i<dfa.final_lst(); i++)
+      d.push_back(i);
+    write(name("dfa",k,".dfa"),k,d);
+  }
+
+
   class FlatZincSpaceInitData {
   public:
     /// Hash table of tuple sets
@@ -766,9 +1007,16 @@ namespace Gecode { namespace FlatZinc {
     typedef std::unordered_set<DFA> DFASet;
     /// Hash table of DFAs
     DFASet dfaSet;
+
+    /// Persistent cache of tables (or NULL)
+    TableCache* tableCache;
     
     /// Initialize
-    FlatZincSpaceInitData(void) {}
+    FlatZincSpaceInitData(void) : tableCache(NULL) {}
+    /// Destructor
+    ~FlatZincSpaceInitData(void) {
+      delete tableCache;
+    }
   };
 
   FlatZincSpace::FlatZincSpace(FlatZincSpace& f)
@@ -877,6 +1125,14 @@ namespace Gecode { namespace FlatZinc {
 #endif
   }
 
+  void
+  FlatZincSpace::tableCache(const std::string& dir) {
+    if (_initData) {
+      delete _initData->tableCache;
+      _initData->tableCache = new TableCache(dir);
+    }
+  }
+
   void
   FlatZincSpace::newIntVar(IntVarSpec* vs) {
     if (vs->alias) {
@@ -2133,16 +2389,30 @@ namespace Gecode { namespace FlatZinc {
   FlatZincSpace::arg2tupleset(const IntArgs& a, int noOfVars) {
     int noOfTuples = a.size() == 0 ? 0 : (a.size()/noOfVars);
 
-    // Build TupleSet
-    TupleSet ts(noOfVars);
-    for (int i=0; i<noOfTuples; i++) {
-      IntArgs t(noOfVars);
-      for (int j=0; j<noOfVars; j++) {
-        t[j] = a[i*noOfVars+j];
+    // Try to find TupleSet in the persistent cache
+    TableCache* tc = (_initData != NULL) ? _initData->tableCache : NULL;
+    std::vector<int> k;
+    TupleSet ts;
+    if (tc != NULL) {
+      k.reserve(noOfTuples*noOfVars+1);
+      k.push_back(noOfVars);
+      for (int i=0; i<noOfTuples*noOfVars; i++)
+        k.push_back(a[i]);
+    }
+    if ((tc == NULL) || !tc->get(k,ts)) {
+      // Build TupleSet
+      ts.init(noOfVars);
+      for (int i=0; i<noOfTuples; i++) {
+        IntArgs t(noOfVars);
+        for (int j=0; j<noOfVars; j++) {
+          t[j] = a[i*noOfVars+j];
+        }
+        ts.add(t);
       }
-      ts.add(t);
+      ts.finalize();
+      if (tc != NULL)
+        tc->put(k,ts);
     }
-    ts.finalize();
 
     if (_initData) {
       FlatZincSpaceInitData::TupleSetSet::iterator it = _initData->tupleSetSet.find(ts);
@@ -2410,6 +2680,31 @@ namespace Gecode { namespace FlatZinc {
     return a;
   }
 
+  DFA
+  FlatZincSpace::arg2dfa(int s, DFA::Transition t[], int f[]) {
+    // Try to find DFA in the persistent cache
+    TableCache* tc = (_initData != NULL) ? _initData->tableCache : NULL;
+    std::vector<int> k;
+    DFA d;
+    if (tc != NULL) {
+      k.push_back(s);
+      for (DFA::Transition* ti = &t[0]; ti->i_state >= 0; ti++) {
+        k.push_back(ti->i_state);
+        k.push_back(ti->symbol);
+        k.push_back(ti->o_state);
+      }
+      k.push_back(-1);
+      for (int* fi = &f[0]; *fi >= 0; fi++)
+        k.push_back(*fi);
+    }
+    if ((tc == NULL) || !tc->get(k,d)) {
+      d = DFA(s,t,f);
+      if (tc != NULL)
+        tc->put(k,d);
+    }
+    return getSharedDFA(d);
+  }
+
   void
   Printer::init(AST::Array* output) {
     _output = output;
@@ -1089,10 +1089,10 @@ namespace Gecode { namespace FlatZinc {
         f[sl->s.size()] = -1;
       }
 
-      DFA dfa(q0,t,f);
+      DFA dfa = s.arg2dfa(q0,t,f);
       free(f);
       unshare(s, iv);
-      extensional(s, iv, s.getSharedDFA(dfa), s.ann2ipl(ann));
+      extensional(s, iv, dfa, s.ann2ipl(ann));
     }
 
     void
@@ -50,6 +50,7 @@
 #include <cfloat>
 
 #include <iostream>
+#include <string>
 #include <vector>
 #include <unordered_map>
 #include <functional>
@@ -2320,6 +2321,10 @@ namespace Gecode {
       Range* range;
       /// Pointer to all support data
       BitSetData* support;
+      /// Memory of file the data has been loaded from (or nullptr)
+      void* file;
+      /// Size of file memory
+      std::size_t file_size;
 
       /// Return newly added tuple
       Tuple add(void);
@@ -2341,6 +2346,12 @@ namespace Gecode {
       /// Resize tuple data
       GECODE_INT_EXPORT
       void resize(void);
+      /// Write finalized data to file \a fn
+      GECODE_INT_EXPORT
+      void save(const std::string& fn) const;
+      /// Initialize from memory \a m of size \a n of a file written by save (takes ownership of \a m)
+      GECODE_INT_EXPORT
+      void load(char* m, std::size_t n);
       /// Is datastructure finalized
       bool finalized(void) const;
       /// Initialize as empty tuple set with arity \a a
@@ -2380,6 +2391,20 @@ namespace Gecode {
     /// Initialize with DFA \a dfa for arity \a a
     GECODE_INT_EXPORT
     TupleSet(int a, const DFA& dfa);
+    /**
+     * \brief Initialize from file \a fn written by save
+     *
+     * The tuple set is finalized and shares the data of the file:
+     * the tuples and supports are not copied but mapped into memory
+     * read-only (if the platform supports memory mapped files), so
+     * that several processes can share the same physical memory.
+     *
+     * Throws an exception of type Int::InvalidTupleSetFile if the file
+     * cannot be read or has not been written by save on a platform
+     * with the same data representation.
+     */
+    GECODE_INT_EXPORT
+    explicit TupleSet(const std::string& fn);
     /// Test whether tuple set has been initialized
     operator bool(void) const;
     /// Test whether tuple set is equal to \a t
@@ -2396,6 +2421,18 @@ namespace Gecode {
     bool finalized(void) const;
     /// Finalize tuple set
     void finalize(void);
+    /**
+     * \brief Write finalized tuple set to file \a fn
+     *
+     * The file stores the tuples together with all information computed
+     * during finalization in binary form, so that a tuple set can be
+     * initialized from it without any further computation. The format
+     * depends on the byte order and word size of the platform.
+     *
+     * Throws an exception of type Int::InvalidTupleSetFile if the file
+     * cannot be written.
+     */
+    void save(const std::string& fn) const;
     //@}
 
     /// \name Tuple access
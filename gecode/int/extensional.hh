@@ -230,6 +230,43 @@ namespace Gecode { namespace Int { namespace Extensional {
    */
   template<unsigned int size> class TinyBitSet;
 
+#if defined(__GNUC__) && defined(__x86_64__)
+  /// Whether vectorized bit-set operations are available
+#define GECODE_INT_EXTENSIONAL_SIMD
+#endif
+
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+  /**
+   * \brief Vectorized operations for sparse bit-sets
+   *
+   * The operations use AVX-512 or AVX2 instructions if supported by
+   * the processor (see Support::simd) and scalar instructions
+   * otherwise. The words of the bit-set are \a w, where the \a j-th
+   * word corresponds to the \a index[j]-th word of other bit-sets.
+   */
+  namespace BitSetSIMD {
+    /// Minimal number of words for which vectorized operations are used
+    const unsigned int words = 16U;
+    /// Test whether \a w[j] and \a b[\a index[j]] intersect for some \a j < \a n
+    template<class IndexType>
+    bool intersects(const BitSetData* w, const IndexType* index,
+                    unsigned int n, const BitSetData* b);
+    /// Add \a b[\a index[j]] to \a mask[j] for all \a j < \a n
+    template<class IndexType>
+    void add_to_mask(const IndexType* index, unsigned int n,
+                     const BitSetData* b, BitSetData* mask);
+    /**
+     * \brief Return largest \a j < \a i such that \a w[j] and \a m[\a index[j]] intersect
+     *
+     * The words of \a m are complemented if \a neg is true. If \a index
+     * is NULL, \a m[j] is used. Returns -1 if there is no such \a j.
+     */
+    template<class IndexType>
+    int last(const BitSetData* w, const IndexType* index, int i,
+             const BitSetData* m, bool neg);
+  }
+#endif
+
   /// Bit-set
   template<class IndexType>
   class BitSet {
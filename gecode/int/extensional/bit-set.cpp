@@ -0,0 +1,314 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int/extensional.hh>
+
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+
+#include <immintrin.h>
+#include <cstring>
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  namespace BitSetSIMD {
+
+    /*
+     * The vectorized operations access bit-set words as 64-bit integers
+     *
+     */
+    static_assert(sizeof(BitSetData) == sizeof(long long int),
+                  "Bit-set words must be 64 bits");
+
+    /// Return words \a w as integers
+    forceinline const long long int*
+    raw(const BitSetData* w) {
+      return reinterpret_cast<const long long int*>(w);
+    }
+
+
+    /*
+     * Loading four indices into 32-bit integers
+     *
+     */
+    __attribute__((target("avx2"))) inline __m128i
+    index4(const unsigned char* i) {
+      int x; std::memcpy(&x,i,sizeof(int));
+      return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(x));
+    }
+    __attribute__((target("avx2"))) inline __m128i
+    index4(const unsigned short int* i) {
+      return _mm_cvtepu16_epi32
+        (_mm_loadl_epi64(reinterpret_cast<const __m128i*>(i)));
+    }
+    __attribute__((target("avx2"))) inline __m128i
+    index4(const unsigned int* i) {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(i));
+    }
+
+    /*
+     * Loading eight indices into 32-bit integers
+     *
+     */
+    __attribute__((target("avx512f"))) inline __m256i
+    index8(const unsigned char* i) {
+      return _mm256_cvtepu8_epi32
+        (_mm_loadl_epi64(reinterpret_cast<const __m128i*>(i)));
+    }
+    __attribute__((target("avx512f"))) inline __m256i
+    index8(const unsigned short int* i) {
+      return _mm256_cvtepu16_epi32
+        (_mm_loadu_si128(reinterpret_cast<const __m128i*>(i)));
+    }
+    __attribute__((target("avx512f"))) inline __m256i
+    index8(const unsigned int* i) {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i));
+    }
+
+
+    /*
+     * Scalar operations
+     *
+     */
+    template<class IndexType>
+    bool
+    intersects_scalar(const BitSetData* w, const IndexType* index,
+                      unsigned int n, const BitSetData* b) {
+      for (unsigned int j=0U; j<n; j++)
+        if (!BitSetData::a(w[j],b[index[j]]).none())
+          return true;
+      return false;
+    }
+
+    template<class IndexType>
+    void
+    add_to_mask_scalar(const IndexType* index, unsigned int n,
+                       const BitSetData* b, BitSetData* mask) {
+      for (unsigned int j=0U; j<n; j++)
+        mask[j] = BitSetData::o(mask[j],b[index[j]]);
+    }
+
+    template<class IndexType>
+    int
+    last_scalar(const BitSetData* w, const IndexType* index, int i,
+                const BitSetData* m, bool neg) {
+      while (i-- > 0) {
+        BitSetData m_i = m[(index != NULL) ? index[i] : i];
+        if (!BitSetData::a(w[i], neg ? ~m_i : m_i).none())
+          return i;
+      }
+      return -1;
+    }
+
+
+    /*
+     * Operations using AVX2 instructions
+     *
+     */
+    template<class IndexType>
+    __attribute__((target("avx2"))) bool
+    intersects_avx2(const BitSetData* w, const IndexType* index,
+                    unsigned int n, const BitSetData* b) {
+      const long long int* wp = raw(w);
+      const long long int* bp = raw(b);
+      unsigned int j = 0U;
+      for (; j+4U <= n; j += 4U) {
+        __m256i x = _mm256_loadu_si256
+          (reinterpret_cast<const __m256i*>(wp+j));
+        __m256i y = _mm256_i32gather_epi64(bp,index4(index+j),8);
+        if (!_mm256_testz_si256(x,y))
+          return true;
+      }
+      return intersects_scalar(w+j,index+j,n-j,b);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) void
+    add_to_mask_avx2(const IndexType* index, unsigned int n,
+                     const BitSetData* b, BitSetData* mask) {
+      const long long int* bp = raw(b);
+      long long int* mp = reinterpret_cast<long long int*>(mask);
+      unsigned int j = 0U;
+      for (; j+4U <= n; j += 4U) {
+        __m256i* m = reinterpret_cast<__m256i*>(mp+j);
+        __m256i y = _mm256_i32gather_epi64(bp,index4(index+j),8);
+        _mm256_storeu_si256(m,_mm256_or_si256(_mm256_loadu_si256(m),y));
+      }
+      add_to_mask_scalar(index+j,n-j,b,mask+j);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) int
+    last_avx2(const BitSetData* w, const IndexType* index, int i,
+              const BitSetData* m, bool neg) {
+      const long long int* wp = raw(w);
+      const long long int* mp = raw(m);
+      __m256i f = neg ? _mm256_set1_epi64x(-1LL) : _mm256_setzero_si256();
+      // Skip blocks of words without intersection
+      while (i >= 4) {
+        __m256i x = _mm256_loadu_si256
+          (reinterpret_cast<const __m256i*>(wp+i-4));
+        __m256i y = (index != NULL) ?
+          _mm256_i32gather_epi64(mp,index4(index+i-4),8) :
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mp+i-4));
+        if (!_mm256_testz_si256(x,_mm256_xor_si256(y,f)))
+          break;
+        i -= 4;
+      }
+      return last_scalar(w,index,i,m,neg);
+    }
+
+
+    /*
+     * Operations using AVX-512 instructions
+     *
+     */
+    template<class IndexType>
+    __attribute__((target("avx512f"))) bool
+    intersects_avx512(const BitSetData* w, const IndexType* index,
+                      unsigned int n, const BitSetData* b) {
+      const long long int* wp = raw(w);
+      const long long int* bp = raw(b);
+      unsigned int j = 0U;
+      for (; j+8U <= n; j += 8U) {
+        __m512i x = _mm512_loadu_si512(wp+j);
+        __m512i y = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(),0xFF,
+                                                index8(index+j),bp,8);
+        if (_mm512_test_epi64_mask(x,y) != 0)
+          return true;
+      }
+      return intersects_scalar(w+j,index+j,n-j,b);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) void
+    add_to_mask_avx512(const IndexType* index, unsigned int n,
+                       const BitSetData* b, BitSetData* mask) {
+      const long long int* bp = raw(b);
+      long long int* mp = reinterpret_cast<long long int*>(mask);
+      unsigned int j = 0U;
+      for (; j+8U <= n; j += 8U) {
+        __m512i y = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(),0xFF,
+                                                index8(index+j),bp,8);
+        _mm512_storeu_si512(mp+j,
+                            _mm512_or_si512(_mm512_loadu_si512(mp+j),y));
+      }
+      add_to_mask_scalar(index+j,n-j,b,mask+j);
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) int
+    last_avx512(const BitSetData* w, const IndexType* index, int i,
+                const BitSetData* m, bool neg) {
+      const long long int* wp = raw(w);
+      const long long int* mp = raw(m);
+      __m512i f = neg ? _mm512_set1_epi64(-1LL) : _mm512_setzero_si512();
+      // Skip blocks of words without intersection
+      while (i >= 8) {
+        __m512i x = _mm512_loadu_si512(wp+i-8);
+        __m512i y = (index != NULL) ?
+          _mm512_mask_i32gather_epi64(_mm512_setzero_si512(),0xFF,
+                                      index8(index+i-8),mp,8) :
+          _mm512_loadu_si512(mp+i-8);
+        if (_mm512_test_epi64_mask(x,_mm512_xor_si512(y,f)) != 0)
+          break;
+        i -= 8;
+      }
+      return last_scalar(w,index,i,m,neg);
+    }
+
+
+    /*
+     * Selecting the operations at runtime
+     *
+     */
+    template<class IndexType>
+    bool
+    intersects(const BitSetData* w, const IndexType* index,
+               unsigned int n, const BitSetData* b) {
+      switch (Support::simd()) {
+      case Support::SIMD_AVX512:
+        return intersects_avx512(w,index,n,b);
+      case Support::SIMD_AVX2:
+        return intersects_avx2(w,index,n,b);
+      default:
+        return intersects_scalar(w,index,n,b);
+      }
+    }
+
+    template<class IndexType>
+    void
+    add_to_mask(const IndexType* index, unsigned int n,
+                const BitSetData* b, BitSetData* mask) {
+      switch (Support::simd()) {
+      case Support::SIMD_AVX512:
+        add_to_mask_avx512(index,n,b,mask); break;
+      case Support::SIMD_AVX2:
+        add_to_mask_avx2(index,n,b,mask); break;
+      default:
+        add_to_mask_scalar(index,n,b,mask); break;
+      }
+    }
+
+    template<class IndexType>
+    int
+    last(const BitSetData* w, const IndexType* index, int i,
+         const BitSetData* m, bool neg) {
+      switch (Support::simd()) {
+      case Support::SIMD_AVX512:
+        return last_avx512(w,index,i,m,neg);
+      case Support::SIMD_AVX2:
+        return last_avx2(w,index,i,m,neg);
+      default:
+        return last_scalar(w,index,i,m,neg);
+      }
+    }
+
+#define GECODE_INT_EXTENSIONAL_SIMD_INSTANTIATE(IndexType)               \
+    template bool                                                        \
+    intersects<IndexType>(const BitSetData*, const IndexType*,           \
+                          unsigned int, const BitSetData*);              \
+    template void                                                        \
+    add_to_mask<IndexType>(const IndexType*, unsigned int,               \
+                           const BitSetData*, BitSetData*);              \
+    template int                                                         \
+    last<IndexType>(const BitSetData*, const IndexType*, int,            \
+                    const BitSetData*, bool);
+
+    GECODE_INT_EXTENSIONAL_SIMD_INSTANTIATE(unsigned char)
+    GECODE_INT_EXTENSIONAL_SIMD_INSTANTIATE(unsigned short int)
+    GECODE_INT_EXTENSIONAL_SIMD_INSTANTIATE(unsigned int)
+
+#undef GECODE_INT_EXTENSIONAL_SIMD_INSTANTIATE
+
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: int-prop
@@ -35,6 +35,8 @@
  *
  */
 
+#include <cstring>
+
 namespace Gecode { namespace Int { namespace Extensional {
 
   template<class IndexType>
@@ -148,16 +150,21 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::clear_mask(BitSetData* mask) const {
     assert(_limit > 0U);
-    for (IndexType i=0; i<_limit; i++) {
-      mask[i].init(false);
-      assert(mask[i].none());
-    }
+    // Leave the choice of instructions to the library
+    std::memset(static_cast<void*>(mask), 0, _limit * sizeof(BitSetData));
+    assert(mask[0].none() && mask[_limit-1].none());
   }
   
   template<class IndexType>
   forceinline void
   BitSet<IndexType>::add_to_mask(const BitSetData* b, BitSetData* mask) const {
     assert(_limit > 0U);
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+    if (_limit >= BitSetSIMD::words) {
+      BitSetSIMD::add_to_mask(_index,_limit,b,mask);
+      return;
+    }
+#endif
     for (IndexType i=0; i<_limit; i++)
       mask[i] = BitSetData::o(mask[i],b[_index[i]]);
   }
@@ -167,6 +174,19 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::intersect_with_mask(const BitSetData* mask) {
     assert(_limit > 0U);
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+    if (_limit >= BitSetSIMD::words) {
+      // Only replace words that change, from the last word downwards
+      int i = _limit;
+      while ((i = BitSetSIMD::last(_bits, sparse ? _index : NULL, i,
+                                   mask, true)) >= 0) {
+        IndexType j = static_cast<IndexType>(i);
+        BitSetData w_a = BitSetData::a(_bits[j], mask[sparse ? _index[j] : j]);
+        replace_and_decrease(j,w_a);
+      }
+      return;
+    }
+#endif
     if (sparse) {
       for (IndexType i = _limit; i--; ) {
         assert(!_bits[i].none());
@@ -206,6 +226,17 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::nand_with_mask(const BitSetData* b) {
     assert(_limit > 0U);
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+    if (_limit >= BitSetSIMD::words) {
+      // Only replace words that change, from the last word downwards
+      int i = _limit;
+      while ((i = BitSetSIMD::last(_bits, _index, i, b, false)) >= 0) {
+        IndexType j = static_cast<IndexType>(i);
+        replace_and_decrease(j,BitSetData::a(_bits[j],~(b[_index[j]])));
+      }
+      return;
+    }
+#endif
     for (IndexType i = _limit; i--; ) {
       assert(!_bits[i].none());
       BitSetData w = BitSetData::a(_bits[i],~(b[_index[i]]));
@@ -217,6 +248,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   template<class IndexType>
   forceinline bool
   BitSet<IndexType>::intersects(const BitSetData* b) const {
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+    if (_limit >= BitSetSIMD::words)
+      return BitSetSIMD::intersects(_bits,_index,_limit,b);
+#endif
     for (IndexType i=0; i<_limit; i++)
       if (!BitSetData::a(_bits[i],b[_index[i]]).none())
         return true;
@@ -37,6 +37,16 @@
 
 #include <gecode/int.hh>
 #include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 namespace Gecode { namespace Int { namespace Extensional {
 
@@ -91,6 +101,150 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
 
+  /**
+   * \brief Header of a tuple set file
+   *
+   * The header is followed by the number of ranges for each position,
+   * the bounds of all ranges, the tuples, and the support words. Each
+   * part starts at a multiple of eight bytes.
+   */
+  class TupleSetFileHeader {
+  public:
+    /// Identification of tuple set files
+    char magic[8];
+    /// Version of the file format
+    unsigned int version;
+    /// Size of the header
+    unsigned int header;
+    /// Bits per support word
+    unsigned int bpb;
+    /// Arity
+    int arity;
+    /// Number of tuples
+    int n_tuples;
+    /// Number of words for support
+    unsigned int n_words;
+    /// Number of ranges
+    unsigned int n_ranges;
+    /// Number of values
+    unsigned int n_vals;
+    /// Smallest value
+    int min;
+    /// Largest value
+    int max;
+    /// Hash key
+    unsigned long long int key;
+    /// Initialize for the current file format
+    TupleSetFileHeader(void);
+    /// Test whether the header belongs to the current file format
+    bool valid(void) const;
+  };
+
+  /// Layout of the parts of a tuple set file
+  class TupleSetFileLayout {
+  public:
+    /// Offset of the number of ranges per position
+    std::size_t n;
+    /// Offset of the range bounds
+    std::size_t range;
+    /// Offset of the tuples
+    std::size_t td;
+    /// Offset of the support words
+    std::size_t support;
+    /// Size of the file
+    std::size_t size;
+    /// Compute layout for header \a h
+    TupleSetFileLayout(const TupleSetFileHeader& h);
+    /// Round \a o up to a multiple of eight bytes
+    static std::size_t align(std::size_t o);
+  };
+
+
+  forceinline
+  TupleSetFileHeader::TupleSetFileHeader(void) {
+    std::memset(static_cast<void*>(this), 0, sizeof(TupleSetFileHeader));
+    std::memcpy(magic, "GecodeTS", sizeof(magic));
+    version = 1U;
+    header = static_cast<unsigned int>(sizeof(TupleSetFileHeader));
+    bpb = Support::BitSetData::bpb;
+  }
+
+  forceinline bool
+  TupleSetFileHeader::valid(void) const {
+    TupleSetFileHeader h;
+    return ((std::memcmp(magic, h.magic, sizeof(magic)) == 0) &&
+            (version == h.version) && (header == h.header) &&
+            (bpb == h.bpb) && (arity > 0) && (n_tuples >= 0));
+  }
+
+
+  forceinline std::size_t
+  TupleSetFileLayout::align(std::size_t o) {
+    return (o + 7U) & ~static_cast<std::size_t>(7U);
+  }
+
+  forceinline
+  TupleSetFileLayout::TupleSetFileLayout(const TupleSetFileHeader& h) {
+    n = align(sizeof(TupleSetFileHeader));
+    range = align(n + sizeof(unsigned int) *
+                  static_cast<std::size_t>(h.arity));
+    td = align(range + 2U * sizeof(int) *
+               static_cast<std::size_t>(h.n_ranges));
+    support = align(td + sizeof(int) *
+                    static_cast<std::size_t>(h.n_tuples) *
+                    static_cast<std::size_t>(h.arity));
+    size = support + sizeof(Support::BitSetData) *
+      static_cast<std::size_t>(h.n_words) *
+      static_cast<std::size_t>(h.n_vals);
+  }
+
+
+  /// Map file \a fn read-only into memory and store its size in \a n
+  static void*
+  map_file(const std::string& fn, std::size_t& n) {
+#ifdef HAVE_MMAP
+    int fd = open(fn.c_str(), O_RDONLY);
+    if (fd == -1)
+      throw InvalidTupleSetFile("TupleSet::TupleSet()");
+    struct stat sbuf;
+    if ((fstat(fd, &sbuf) == -1) || (sbuf.st_size == 0)) {
+      close(fd);
+      throw InvalidTupleSetFile("TupleSet::TupleSet()");
+    }
+    n = static_cast<std::size_t>(sbuf.st_size);
+    void* m = mmap(nullptr, n, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping remains valid after closing the file
+    close(fd);
+    if (m == MAP_FAILED)
+      throw InvalidTupleSetFile("TupleSet::TupleSet()");
+    return m;
+#else
+    std::ifstream f(fn.c_str(), std::ios::in | std::ios::binary);
+    if (!f.seekg(0, std::ios::end))
+      throw InvalidTupleSetFile("TupleSet::TupleSet()");
+    n = static_cast<std::size_t>(f.tellg());
+    char* m = heap.alloc<char>(n);
+    if (!f.seekg(0, std::ios::beg) ||
+        !f.read(m, static_cast<std::streamsize>(n))) {
+      heap.rfree(m);
+      throw InvalidTupleSetFile("TupleSet::TupleSet()");
+    }
+    return m;
+#endif
+  }
+
+  /// Release memory \a m of size \a n for a mapped file
+  static void
+  unmap_file(void* m, std::size_t n) {
+#ifdef HAVE_MMAP
+    (void) munmap(m, n);
+#else
+    (void) n;
+    heap.rfree(m);
+#endif
+  }
+
+
 }}}
 
 namespace Gecode {
@@ -251,11 +405,167 @@ namespace Gecode {
     n_free = n - n_tuples;
   }
 
-  TupleSet::Data::~Data(void) {
+  void
+  TupleSet::Data::save(const std::string& fn) const {
+    using namespace Int::Extensional;
+    assert(finalized());
+    TupleSetFileHeader h;
+    h.arity = arity; h.n_tuples = n_tuples; h.n_words = n_words;
+    h.min = min; h.max = max;
+    h.key = static_cast<unsigned long long int>(key);
+    // Number of ranges per position (none for an empty tuple set)
+    Region r;
+    unsigned int* n = r.alloc<unsigned int>(arity);
+    for (int a=0; a<arity; a++) {
+      n[a] = (n_tuples > 0) ? vd[a].n : 0U;
+      h.n_ranges += n[a];
+      for (unsigned int i=0U; i<n[a]; i++)
+        h.n_vals += vd[a].r[i].width();
+    }
+    TupleSetFileLayout l(h);
+
+    std::ofstream f(fn.c_str(), std::ios::out | std::ios::binary |
+                    std::ios::trunc);
+    // Write padding up to offset o
+    auto pad = [&f](std::size_t o) {
+      static const char zero[8] = {0,0,0,0,0,0,0,0};
+      if (!f)
+        return;
+      std::size_t p = static_cast<std::size_t>(f.tellp());
+      assert((p <= o) && (o - p < 8U));
+      f.write(zero, static_cast<std::streamsize>(o - p));
+    };
+    f.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    pad(l.n);
+    f.write(reinterpret_cast<const char*>(n),
+            static_cast<std::streamsize>(sizeof(unsigned int) * arity));
+    pad(l.range);
+    for (int a=0; a<arity; a++)
+      for (unsigned int i=0U; i<n[a]; i++) {
+        int b[2] = {vd[a].r[i].min, vd[a].r[i].max};
+        f.write(reinterpret_cast<const char*>(b), sizeof(b));
+      }
+    pad(l.td);
+    f.write(reinterpret_cast<const char*>(td),
+            static_cast<std::streamsize>(l.support - l.td));
+    pad(l.support);
+    f.write(reinterpret_cast<const char*>(support),
+            static_cast<std::streamsize>(l.size - l.support));
+    f.close();
+    if (!f)
+      throw Int::InvalidTupleSetFile("TupleSet::save()");
+  }
+
+  void
+  TupleSet::Data::load(char* m, std::size_t n) {
+    using namespace Int::Extensional;
+    assert(!finalized() && (n_tuples == 0));
+    TupleSetFileHeader h;
+    std::memcpy(static_cast<void*>(&h), m, sizeof(TupleSetFileHeader));
+    // Check the header such that the layout cannot overflow
+    if (!h.valid() || (h.arity != arity) ||
+        (static_cast<std::size_t>(h.arity) > n / sizeof(unsigned int)) ||
+        (h.n_ranges > n / (2U * sizeof(int))) ||
+        (static_cast<std::size_t>(h.n_tuples) >
+         n / sizeof(int) / static_cast<std::size_t>(h.arity)) ||
+        ((h.n_vals > 0U) &&
+         (h.n_words > n / sizeof(BitSetData) / h.n_vals)) ||
+        (h.n_words != BitSetData::data(static_cast<unsigned int>(h.n_tuples)))
+        || ((h.n_tuples == 0) && (h.n_ranges != 0U)) ||
+        ((h.n_tuples > 0) && (h.min > h.max)) ||
+        (TupleSetFileLayout(h).size != n)) {
+      unmap_file(m,n);
+      throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+    }
+    TupleSetFileLayout l(h);
+    const unsigned int* n_r = reinterpret_cast<const unsigned int*>(m+l.n);
+    const int* b = reinterpret_cast<const int*>(m+l.range);
+    const int* t = reinterpret_cast<const int*>(m+l.td);
+    // Check that the ranges and tuples are consistent with the header
+    {
+      bool ok = true;
+      unsigned int n_ranges = 0U;
+      unsigned long long int n_vals = 0ULL;
+      for (int a=0; ok && (a<arity); a++)
+        if ((n_r[a] > h.n_ranges - n_ranges) ||
+            ((h.n_tuples > 0) && (n_r[a] == 0U)))
+          ok = false;
+        else
+          n_ranges += n_r[a];
+      ok = ok && (n_ranges == h.n_ranges);
+      // Ranges must be sorted, disjoint, and within the bounds
+      for (int a=0, i=0; ok && (a<arity); a++)
+        for (unsigned int k=0U; ok && (k<n_r[a]); k++, i++)
+          if ((b[2*i] > b[2*i+1]) || (b[2*i] < h.min) ||
+              (b[2*i+1] > h.max) || ((k > 0U) && (b[2*i-1] >= b[2*i])))
+            ok = false;
+          else
+            n_vals += static_cast<unsigned long long int>
+              (static_cast<long long int>(b[2*i+1]) - b[2*i] + 1);
+      ok = ok && (n_vals == h.n_vals);
+      // Tuple values must be contained in the ranges of their position
+      for (int a=0, f=0; ok && (a<arity); f += n_r[a], a++)
+        for (int k=0; ok && (k<h.n_tuples); k++) {
+          int v = t[k*arity+a];
+          // Binary search for range containing v
+          int lo = f, hi = f + static_cast<int>(n_r[a]) - 1;
+          while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (b[2*mid+1] < v)
+              lo = mid + 1;
+            else
+              hi = mid;
+          }
+          ok = (b[2*lo] <= v) && (v <= b[2*lo+1]);
+        }
+      if (!ok) {
+        unmap_file(m,n);
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+      }
+    }
+
+    // Tuples and supports are used in place
     heap.rfree(td);
+    file = m; file_size = n;
+    td = reinterpret_cast<int*>(m+l.td);
+    support = reinterpret_cast<BitSetData*>(m+l.support);
+    n_tuples = h.n_tuples; n_words = h.n_words;
+    min = h.min; max = h.max;
+    key = static_cast<std::size_t>(h.key);
+    n_free = -1;
+    if (n_tuples == 0) {
+      td = nullptr; support = nullptr;
+      assert(finalized());
+      return;
+    }
+    // Only the ranges must be set up with pointers to their supports
+    Range* cr = range = heap.alloc<Range>(h.n_ranges);
+    BitSetData* cs = support;
+    for (int a=0; a<arity; a++) {
+      vd[a].n = n_r[a];
+      vd[a].r = cr;
+      for (unsigned int i=0U; i<vd[a].n; i++) {
+        cr->min = *b++; cr->max = *b++;
+        cr->s = cs;
+        cs += n_words * cr->width();
+        cr++;
+      }
+    }
+    assert(cs == support + n_words * h.n_vals);
+    assert(cr == range + h.n_ranges);
+    assert(finalized());
+  }
+
+  TupleSet::Data::~Data(void) {
+    using namespace Int::Extensional;
+    if (file != nullptr) {
+      unmap_file(file,file_size);
+    } else {
+      heap.rfree(td);
+      heap.rfree(support);
+    }
     heap.rfree(vd);
     heap.rfree(range);
-    heap.rfree(support);
   }
 
 
@@ -271,6 +581,29 @@ namespace Gecode {
   }
   TupleSet::TupleSet(const TupleSet& ts)
     : SharedHandle(ts) {}
+  TupleSet::TupleSet(const std::string& fn) {
+    using namespace Int::Extensional;
+    std::size_t n;
+    char* m = static_cast<char*>(map_file(fn,n));
+    // Find arity from header first
+    TupleSetFileHeader h;
+    if (n >= sizeof(TupleSetFileHeader))
+      std::memcpy(static_cast<void*>(&h), m, sizeof(TupleSetFileHeader));
+    if ((n < sizeof(TupleSetFileHeader)) || !h.valid() ||
+        (static_cast<std::size_t>(h.arity) > n / sizeof(unsigned int))) {
+      unmap_file(m,n);
+      throw Int::InvalidTupleSetFile("TupleSet::TupleSet()");
+    }
+    Data* d = new Data(h.arity);
+    try {
+      // Takes ownership of the file memory, even if invalid
+      d->load(m,n);
+    } catch (...) {
+      delete d;
+      throw;
+    }
+    object(d);
+  }
   TupleSet&
   TupleSet::operator =(const TupleSet& ts) {
     (void) SharedHandle::operator =(ts);
@@ -64,7 +64,7 @@ namespace Gecode {
       min(Int::Limits::max), max(Int::Limits::min), key(0),
       td(heap.alloc<int>(n_initial_free * a)),
       vd(heap.alloc<ValueData>(a)),
-      range(nullptr), support(nullptr) {
+      range(nullptr), support(nullptr), file(nullptr), file_size(0) {
   }
   
   forceinline bool
@@ -158,6 +158,15 @@ namespace Gecode {
       d->finalize();
   }
 
+  forceinline void
+  TupleSet::save(const std::string& fn) const {
+    if (!*this)
+      throw Int::UninitializedTupleSet("TupleSet::save()");
+    if (!finalized())
+      throw Int::NotYetFinalized("TupleSet::save()");
+    data().save(fn);
+  }
+
   forceinline bool
   TupleSet::finalized(void) const {
     return static_cast<Data*>(object())->finalized();
@@ -767,10 +767,164 @@ namespace Gecode { namespace Int { namespace Linear {
     post(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c, BoolView b);
   };
 
+
+  /**
+   * \brief Minimal number of views for incremental linear propagators
+   *
+   * For linear equations and inequations with at least this many
+   * views, the incremental propagators IncEq and IncLq are used.
+   */
+  const int inc_views = 32;
+
+  /**
+   * \brief Base-class for incremental n-ary linear propagators
+   *
+   * The minimal and maximal value of the left-hand side of the linear
+   * constraint are maintained by an advisor per view. The propagator
+   * is only run if the difference between the bounds of some view
+   * might exceed the slack between the right-hand side and one of
+   * the values, that is, only if a view can actually be pruned.
+   *
+   * The type \a Val can be either \c long long int or \c int, defining the
+   * numerical precision during propagation. Positive views are of
+   * type \a P whereas negative views are of type \a N.
+   */
+  template<class Val, class P, class N>
+  class IncLin : public Propagator {
+  protected:
+    /// %Advisor for a single view
+    class Idx : public Advisor {
+    public:
+      /// Whether the view is positive (in \a x)
+      const bool pos;
+      /// Position of the view
+      const int i;
+      /// Lower bound of the view when last advised
+      Val l;
+      /// Upper bound of the view when last advised
+      Val u;
+      /// Create advisor for view at position \a i
+      Idx(Space& home, Propagator& p, Council<Idx>& c,
+          bool pos, int i, Val l, Val u);
+      /// Clone advisor \a a
+      Idx(Space& home, Idx& a);
+    };
+    /// Array of positive views
+    ViewArray<P> x;
+    /// Array of negative views
+    ViewArray<N> y;
+    /// Constant value
+    Val c;
+    /// Minimal value of the left-hand side
+    Val lo;
+    /// Maximal value of the left-hand side
+    Val hi;
+    /// Upper bound on the difference between the bounds of all views
+    Val w;
+    /// Number of views not yet assigned
+    int n;
+    /// The advisor council
+    Council<Idx> co;
+    /// Update bounds for the view of advisor \a a, return whether assigned
+    bool update(Idx& a);
+    /// Constructor for cloning \a p
+    IncLin(Space& home, IncLin& p);
+    /// Constructor for creation
+    IncLin(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c);
+  public:
+    /// Cost function (defined as low linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /**
+   * \brief %Propagator for incremental bounds consistent n-ary linear equality
+   *
+   * The type \a Val can be either \c long long int or \c int, defining the
+   * numerical precision during propagation. The types \a P and \a N
+   * give the types of the views.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class Val, class P, class N>
+  class IncEq : public IncLin<Val,P,N> {
+  protected:
+    using IncLin<Val,P,N>::x;
+    using IncLin<Val,P,N>::y;
+    using IncLin<Val,P,N>::c;
+    using IncLin<Val,P,N>::lo;
+    using IncLin<Val,P,N>::hi;
+    using IncLin<Val,P,N>::w;
+    using IncLin<Val,P,N>::n;
+    using IncLin<Val,P,N>::co;
+    /// Test whether a view can be pruned or the propagator is subsumed
+    bool run(void) const;
+    /// Constructor for cloning \a p
+    IncEq(Space& home, IncEq& p);
+  public:
+    /// Constructor for creation
+    IncEq(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c);
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i=c\f$
+    static ExecStatus
+    post(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c);
+  };
+
+  /**
+   * \brief %Propagator for incremental bounds consistent n-ary linear less or equal
+   *
+   * The type \a Val can be either \c long long int or \c int, defining the
+   * numerical precision during propagation. The types \a P and \a N
+   * give the types of the views.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class Val, class P, class N>
+  class IncLq : public IncLin<Val,P,N> {
+  protected:
+    using IncLin<Val,P,N>::x;
+    using IncLin<Val,P,N>::y;
+    using IncLin<Val,P,N>::c;
+    using IncLin<Val,P,N>::lo;
+    using IncLin<Val,P,N>::hi;
+    using IncLin<Val,P,N>::w;
+    using IncLin<Val,P,N>::n;
+    using IncLin<Val,P,N>::co;
+    /// Test whether a view can be pruned or the propagator is subsumed
+    bool run(void) const;
+    /// Constructor for cloning \a p
+    IncLq(Space& home, IncLq& p);
+  public:
+    /// Constructor for creation
+    IncLq(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c);
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i\leq c\f$
+    static ExecStatus
+    post(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c);
+  };
+
 }}}
 
 #include <gecode/int/linear/int-nary.hpp>
 #include <gecode/int/linear/int-dom.hpp>
+#include <gecode/int/linear/int-inc.hpp>
 
 namespace Gecode { namespace Int { namespace Linear {
 
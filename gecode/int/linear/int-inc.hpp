@@ -0,0 +1,305 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Advisors for incremental linear propagators
+   *
+   */
+  template<class Val, class P, class N>
+  forceinline
+  IncLin<Val,P,N>::Idx::Idx(Space& home, Propagator& p, Council<Idx>& c,
+                            bool p0, int i0, Val l0, Val u0)
+    : Advisor(home,p,c), pos(p0), i(i0), l(l0), u(u0) {}
+
+  template<class Val, class P, class N>
+  forceinline
+  IncLin<Val,P,N>::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), pos(a.pos), i(a.i), l(a.l), u(a.u) {}
+
+
+  /*
+   * Incremental linear propagators
+   *
+   */
+  template<class Val, class P, class N>
+  forceinline
+  IncLin<Val,P,N>::IncLin(Home home, ViewArray<P>& x0, ViewArray<N>& y0,
+                          Val c0)
+    : Propagator(home), x(x0), y(y0), c(c0), lo(0), hi(0), w(0), n(0),
+      co(home) {
+    for (int i=0; i<x.size(); i++) {
+      Val l = x[i].min(); Val u = x[i].max();
+      lo += l; hi += u; w = std::max(w,u-l);
+      if (!x[i].assigned()) {
+        x[i].subscribe(home,*new (home) Idx(home,*this,co,true,i,l,u));
+        n++;
+      }
+    }
+    for (int i=0; i<y.size(); i++) {
+      Val l = y[i].min(); Val u = y[i].max();
+      lo -= u; hi -= l; w = std::max(w,u-l);
+      if (!y[i].assigned()) {
+        y[i].subscribe(home,*new (home) Idx(home,*this,co,false,i,l,u));
+        n++;
+      }
+    }
+    IntView::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class P, class N>
+  forceinline
+  IncLin<Val,P,N>::IncLin(Space& home, IncLin<Val,P,N>& p)
+    : Propagator(home,p), c(p.c), lo(p.lo), hi(p.hi), w(p.w), n(p.n) {
+    x.update(home,p.x);
+    y.update(home,p.y);
+    co.update(home,p.co);
+  }
+
+  template<class Val, class P, class N>
+  forceinline bool
+  IncLin<Val,P,N>::update(Idx& a) {
+    bool assigned;
+    if (a.pos) {
+      Val l = x[a.i].min(); Val u = x[a.i].max();
+      lo += l - a.l; hi += u - a.u;
+      a.l = l; a.u = u;
+      assigned = x[a.i].assigned();
+    } else {
+      Val l = y[a.i].min(); Val u = y[a.i].max();
+      lo -= u - a.u; hi -= l - a.l;
+      a.l = l; a.u = u;
+      assigned = y[a.i].assigned();
+    }
+    if (assigned)
+      n--;
+    return assigned;
+  }
+
+  template<class Val, class P, class N>
+  PropCost
+  IncLin<Val,P,N>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO, x.size()+y.size());
+  }
+
+  template<class Val, class P, class N>
+  forceinline size_t
+  IncLin<Val,P,N>::dispose(Space& home) {
+    for (Advisors<Idx> as(co); as(); ++as) {
+      if (as.advisor().pos)
+        x[as.advisor().i].cancel(home,as.advisor());
+      else
+        y[as.advisor().i].cancel(home,as.advisor());
+      as.advisor().dispose(home,co);
+    }
+    co.dispose(home);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  /*
+   * Incremental bounds consistent linear equation
+   *
+   */
+  template<class Val, class P, class N>
+  forceinline
+  IncEq<Val,P,N>::IncEq(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c)
+    : IncLin<Val,P,N>(home,x,y,c) {}
+
+  template<class Val, class P, class N>
+  ExecStatus
+  IncEq<Val,P,N>::post(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c) {
+    ViewArray<NoView> nva;
+    if (y.size() == 0) {
+      (void) new (home) IncEq<Val,P,NoView>(home,x,nva,c);
+    } else if (x.size() == 0) {
+      (void) new (home) IncEq<Val,N,NoView>(home,y,nva,-c);
+    } else {
+      (void) new (home) IncEq<Val,P,N>(home,x,y,c);
+    }
+    return ES_OK;
+  }
+
+  template<class Val, class P, class N>
+  forceinline
+  IncEq<Val,P,N>::IncEq(Space& home, IncEq<Val,P,N>& p)
+    : IncLin<Val,P,N>(home,p) {}
+
+  template<class Val, class P, class N>
+  Actor*
+  IncEq<Val,P,N>::copy(Space& home) {
+    return new (home) IncEq<Val,P,N>(home,*this);
+  }
+
+  template<class Val, class P, class N>
+  forceinline bool
+  IncEq<Val,P,N>::run(void) const {
+    return (c - lo < w) || (hi - c < w) || (n == 0);
+  }
+
+  template<class Val, class P, class N>
+  ExecStatus
+  IncEq<Val,P,N>::advise(Space& home, Advisor& _a, const Delta&) {
+    typename IncLin<Val,P,N>::Idx& a =
+      static_cast<typename IncLin<Val,P,N>::Idx&>(_a);
+    if (this->update(a))
+      return run() ? home.ES_NOFIX_DISPOSE(co,a)
+        : home.ES_FIX_DISPOSE(co,a);
+    return run() ? ES_NOFIX : ES_FIX;
+  }
+
+  template<class Val, class P, class N>
+  void
+  IncEq<Val,P,N>::reschedule(Space& home) {
+    if (run())
+      IntView::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class P, class N>
+  ExecStatus
+  IncEq<Val,P,N>::propagate(Space& home, const ModEventDelta&) {
+    /*
+     * The bounds lo and hi are updated by the advisors while views
+     * are pruned, hence the slack is always computed from them.
+     */
+    Val wn = 0;
+    for (int i=0; i<x.size(); i++)
+      if (!x[i].assigned()) {
+        if (x[i].max() - x[i].min() > c - lo)
+          GECODE_ME_CHECK(x[i].lq(home,x[i].min() + (c - lo)));
+        if (x[i].max() - x[i].min() > hi - c)
+          GECODE_ME_CHECK(x[i].gq(home,x[i].max() - (hi - c)));
+        wn = std::max(wn,static_cast<Val>(x[i].max() - x[i].min()));
+      }
+    for (int i=0; i<y.size(); i++)
+      if (!y[i].assigned()) {
+        if (y[i].max() - y[i].min() > c - lo)
+          GECODE_ME_CHECK(y[i].gq(home,y[i].max() - (c - lo)));
+        if (y[i].max() - y[i].min() > hi - c)
+          GECODE_ME_CHECK(y[i].lq(home,y[i].min() + (hi - c)));
+        wn = std::max(wn,static_cast<Val>(y[i].max() - y[i].min()));
+      }
+    if ((lo > c) || (hi < c))
+      return ES_FAILED;
+    w = wn;
+    if (w == 0)
+      return home.ES_SUBSUMED(*this);
+    return run() ? ES_NOFIX : ES_FIX;
+  }
+
+
+  /*
+   * Incremental bounds consistent linear inequation
+   *
+   */
+  template<class Val, class P, class N>
+  forceinline
+  IncLq<Val,P,N>::IncLq(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c)
+    : IncLin<Val,P,N>(home,x,y,c) {}
+
+  template<class Val, class P, class N>
+  ExecStatus
+  IncLq<Val,P,N>::post(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c) {
+    ViewArray<NoView> nva;
+    if (y.size() == 0) {
+      (void) new (home) IncLq<Val,P,NoView>(home,x,nva,c);
+    } else if (x.size() == 0) {
+      (void) new (home) IncLq<Val,NoView,N>(home,nva,y,c);
+    } else {
+      (void) new (home) IncLq<Val,P,N>(home,x,y,c);
+    }
+    return ES_OK;
+  }
+
+  template<class Val, class P, class N>
+  forceinline
+  IncLq<Val,P,N>::IncLq(Space& home, IncLq<Val,P,N>& p)
+    : IncLin<Val,P,N>(home,p) {}
+
+  template<class Val, class P, class N>
+  Actor*
+  IncLq<Val,P,N>::copy(Space& home) {
+    return new (home) IncLq<Val,P,N>(home,*this);
+  }
+
+  template<class Val, class P, class N>
+  forceinline bool
+  IncLq<Val,P,N>::run(void) const {
+    return (c - lo < w) || (hi <= c) || (n == 0);
+  }
+
+  template<class Val, class P, class N>
+  ExecStatus
+  IncLq<Val,P,N>::advise(Space& home, Advisor& _a, const Delta&) {
+    typename IncLin<Val,P,N>::Idx& a =
+      static_cast<typename IncLin<Val,P,N>::Idx&>(_a);
+    if (this->update(a))
+      return run() ? home.ES_NOFIX_DISPOSE(co,a)
+        : home.ES_FIX_DISPOSE(co,a);
+    return run() ? ES_NOFIX : ES_FIX;
+  }
+
+  template<class Val, class P, class N>
+  void
+  IncLq<Val,P,N>::reschedule(Space& home) {
+    if (run())
+      IntView::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class P, class N>
+  ExecStatus
+  IncLq<Val,P,N>::propagate(Space& home, const ModEventDelta&) {
+    if (lo > c)
+      return ES_FAILED;
+    if (hi <= c)
+      return home.ES_SUBSUMED(*this);
+    // Pruning does not change lo, hence one pass computes a fixpoint
+    Val s = c - lo;
+    Val wn = 0;
+    for (int i=0; i<x.size(); i++)
+      if (!x[i].assigned()) {
+        if (x[i].max() - x[i].min() > s)
+          GECODE_ME_CHECK(x[i].lq(home,x[i].min() + s));
+        wn = std::max(wn,static_cast<Val>(x[i].max() - x[i].min()));
+      }
+    for (int i=0; i<y.size(); i++)
+      if (!y[i].assigned()) {
+        if (y[i].max() - y[i].min() > s)
+          GECODE_ME_CHECK(y[i].gq(home,y[i].max() - s));
+        wn = std::max(wn,static_cast<Val>(y[i].max() - y[i].min()));
+      }
+    w = wn;
+    if ((w == 0) || (hi <= c))
+      return home.ES_SUBSUMED(*this);
+    return ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -159,13 +159,19 @@ namespace Gecode { namespace Int { namespace Linear {
             ViewArray<View>& x, ViewArray<View>& y, IntRelType irt, Val c) {
     switch (irt) {
     case IRT_EQ:
-      GECODE_ES_FAIL((Eq<Val,View,View >::post(home,x,y,c)));
+      if (x.size() + y.size() >= inc_views)
+        GECODE_ES_FAIL((IncEq<Val,View,View >::post(home,x,y,c)));
+      else
+        GECODE_ES_FAIL((Eq<Val,View,View >::post(home,x,y,c)));
       break;
     case IRT_NQ:
       GECODE_ES_FAIL((Nq<Val,View,View >::post(home,x,y,c)));
       break;
     case IRT_LQ:
-      GECODE_ES_FAIL((Lq<Val,View,View >::post(home,x,y,c)));
+      if (x.size() + y.size() >= inc_views)
+        GECODE_ES_FAIL((IncLq<Val,View,View >::post(home,x,y,c)));
+      else
+        GECODE_ES_FAIL((Lq<Val,View,View >::post(home,x,y,c)));
       break;
     default: GECODE_NEVER;
     }
@@ -108,6 +108,13 @@ namespace Gecode {
     const double chb_alpha_decrement = 1e-6;
     /// Initial value for Q-score in CHB
     const double chb_qscore_init = 0.05;
+
+    /// Decay factor for learned propagator cost and gain
+    const float feedback_decay = 0.75f;
+    /// Decay factor for the learned cost averaged over all propagators
+    const float feedback_mean_decay = 0.99f;
+    /// Learned cost per modification, relative to the average, of the cheapest propagators
+    const float feedback_unit = 0.25f;
   }}
 
 }
@@ -260,6 +267,7 @@ namespace Gecode {
 #include <gecode/kernel/trace/tracer.hpp>
 #include <gecode/kernel/trace/recorder.hpp>
 #include <gecode/kernel/trace/print.hpp>
+#include <gecode/kernel/trace/profiler.hpp>
 
 namespace Gecode {
 
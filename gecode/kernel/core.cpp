@@ -133,6 +133,7 @@ namespace Gecode {
       pc.p.queue[i].init();
     pc.p.bid_sc = (reserved_bid+1) << sc_bits;
     pc.p.n_sub  = 0;
+    pc.p.n_mod  = 0;
     pc.p.vti.other();
   }
 
@@ -395,8 +396,14 @@ namespace Gecode {
 
         // Find a non-disabled tracer recorder (possibly null)
         TraceRecorder* tr = findtracerecorder();
+        // Find propagator profiler (possibly null)
+        PropagatorProfiler* pp = profiler();
+        // Whether propagator cost must be learned
+        bool fb = feedback();
         // Remember post information
         ViewTraceInfo vti(pc.p.vti);
+        // Result of propagation
+        ExecStatus es;
         goto t_unstable;
 
       t_execute:
@@ -408,7 +415,24 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
-        switch (p->propagate(*this,med_o)) {
+        if ((pp != NULL) || fb) {
+          // The propagator might be deleted when being subsumed
+          PropagatorProfiler::Entry* e =
+            (pp != NULL) ? &pp->entry(*p) : NULL;
+          Kernel::GPI::Info& gi = p->gpi();
+          unsigned long int n_mod = pc.p.n_mod;
+          unsigned long long int t = Support::ticks();
+          es = p->propagate(*this,med_o);
+          t = Support::ticks() - t;
+          n_mod = pc.p.n_mod - n_mod;
+          if (e != NULL)
+            e->record(es,t,n_mod);
+          if (fb)
+            ssd.data().gpi.learn(gi,t,n_mod);
+        } else {
+          es = p->propagate(*this,med_o);
+        }
+        switch (es) {
         case ES_FAILED:
           GECODE_STATUS_TRACE(p,FAILED);
           goto failed;
@@ -747,7 +771,7 @@ namespace Gecode {
   }
 
   Space*
-  Space::_clone(void) {
+  Space::_clone(CloneStatistics& stat) {
     if (failed())
       throw SpaceFailed("Space::clone");
     if (!stable())
@@ -794,11 +818,13 @@ namespace Gecode {
     c->update(static_cast<ActorLink**>(c->mm.subscriptions()));
 
     // Re-establish prev links (reset forwarding information)
+    unsigned long int n_p = 0UL, n_b = 0UL;
     {
       ActorLink* p_a = &pl;
       ActorLink* c_a = p_a->next();
       // First update propagators and advisors
       while (c_a != &pl) {
+        n_p++;
         Propagator* p = Propagator::cast(c_a);
         if (p->u.advisors != NULL) {
           ActorLink* a = p->u.advisors;
@@ -815,9 +841,12 @@ namespace Gecode {
       ActorLink* c_a = p_a->next();
       // Update branchers
       while (c_a != &bl) {
+        n_b++;
         c_a->prev(p_a); p_a = c_a; c_a = c_a->next();
       }
     }
+    // Statistics are updated once per clone
+    stat.clone++; stat.propagator += n_p; stat.brancher += n_b;
 
     // Reset links for local objects
     for (ActorLink* l = c->pc.c.local; l != NULL; l = l->next())
@@ -830,6 +859,7 @@ namespace Gecode {
     // Copy propagation only data
     c->pc.p.n_sub  = pc.p.n_sub;
     c->pc.p.bid_sc = pc.p.bid_sc;
+    c->pc.p.n_mod  = 0;
 
     // Reset execution information
     c->pc.p.vti.other(); pc.p.vti.other();
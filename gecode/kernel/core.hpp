@@ -1708,6 +1708,12 @@ namespace Gecode {
    */
   class CloneStatistics {
   public:
+    /// Number of clones created
+    unsigned long int clone;
+    /// Number of propagators copied
+    unsigned long int propagator;
+    /// Number of branchers copied
+    unsigned long int brancher;
     /// Initialize
     CloneStatistics(void);
     /// Reset information
@@ -1804,13 +1810,17 @@ namespace Gecode {
     static const unsigned reserved_bid = 0U;
 
     /// Number of bits for status control
-    static const unsigned int sc_bits = 2;
+    static const unsigned int sc_bits = 4;
     /// No special features activated
     static const unsigned int sc_fast = 0;
     /// Disabled propagators are supported
     static const unsigned int sc_disabled = 1;
     /// Tracing is supported
     static const unsigned int sc_trace = 2;
+    /// Propagators are scheduled by learned cost
+    static const unsigned int sc_feedback = 4;
+    /// Propagators are profiled
+    static const unsigned int sc_profile = 8;
 
     union {
       /// Data only available during propagation or branching
@@ -1833,12 +1843,16 @@ namespace Gecode {
         /**
          * \brief Id of next brancher to be created plus status control
          *
-         * The last two bits are reserved for status control.
+         * The last four bits are reserved for status control. Hence,
+         * at most \f$2^{28}-1\f$ branchers can be created for a space
+         * and its clones, otherwise TooManyBranchers is thrown.
          *
          */
         unsigned int bid_sc;
         /// Number of subscriptions
         unsigned int n_sub;
+        /// Number of variable modifications (only if profiled or with feedback)
+        unsigned long int n_mod;
         /// View trace information
         ViewTraceInfo vti;
       } p;
@@ -1898,8 +1912,10 @@ namespace Gecode {
      * Throws an exception of type SpaceNotCloned when the copy constructor
      * of the Space class is not invoked during cloning.
      *
+     * The statistics \a stat are updated by the number of copied actors.
+     *
      */
-    GECODE_KERNEL_EXPORT Space* _clone(void);
+    GECODE_KERNEL_EXPORT Space* _clone(CloneStatistics& stat);
 
     /**
      * \brief Commit choice \a c for alternative \a a
@@ -2655,6 +2671,31 @@ namespace Gecode {
     GECODE_KERNEL_EXPORT void afc_unshare(void);
     //@}
 
+    /// \name Low-level support for profiling propagators
+    //@{
+    /// Record all propagator executions (for this space and its clones) in \a p
+    void profile(PropagatorProfiler& p);
+    /// Return propagator profiler (NULL if propagation is not profiled)
+    PropagatorProfiler* profiler(void) const;
+    //@}
+
+    /// \name Low-level support for scheduling propagators
+    //@{
+    /**
+     * \brief %Set whether propagators are scheduled by learned cost
+     *
+     * If \a b is true, the space (and its clones) measure the time
+     * spent by each propagator and the number of variable modifications
+     * it performs. The queue a propagator is scheduled in is then
+     * chosen by the learned cost per modification rather than by the
+     * static cost returned by Propagator::cost. The learned
+     * information is shared among clones.
+     */
+    void feedback(bool b);
+    /// Return whether propagators are scheduled by learned cost
+    bool feedback(void) const;
+    //@}
+
   protected:
     /**
      * \brief Class to iterate over propagators of a space
@@ -3221,11 +3262,11 @@ namespace Gecode {
   }
 
   forceinline Space*
-  Space::clone(CloneStatistics&) const {
+  Space::clone(CloneStatistics& stat) const {
     // Clone is only const for search engines. During cloning, several data
     // structures are updated (e.g. forwarding pointers), so we have to
     // cast away the constness.
-    return const_cast<Space*>(this)->_clone();
+    return const_cast<Space*>(this)->_clone(stat);
   }
 
   forceinline void
@@ -3248,6 +3289,30 @@ namespace Gecode {
     ssd.data().gpi.decay(d);
   }
 
+  forceinline void
+  Space::profile(PropagatorProfiler& p) {
+    ssd.data().profiler = &p;
+    pc.p.bid_sc |= sc_profile;
+  }
+
+  forceinline PropagatorProfiler*
+  Space::profiler(void) const {
+    return ssd.data().profiler;
+  }
+
+  forceinline void
+  Space::feedback(bool b) {
+    if (b)
+      pc.p.bid_sc |= sc_feedback;
+    else
+      pc.p.bid_sc &= ~sc_feedback;
+  }
+
+  forceinline bool
+  Space::feedback(void) const {
+    return (pc.p.bid_sc & sc_feedback) != 0U;
+  }
+
   forceinline size_t
   Actor::dispose(Space&) {
     return sizeof(*this);
@@ -4013,6 +4078,26 @@ namespace Gecode {
 
 
 
+  /*
+   * Learned propagator cost
+   *
+   */
+  forceinline unsigned int
+  Kernel::GPI::queue(const Info& i, unsigned int ac) const {
+    float c = i.cost.load(std::memory_order_relaxed);
+    float a = mc.load(std::memory_order_relaxed);
+    if ((c == 0.0f) || (a == 0.0f))
+      return ac;
+    // Cost per modification relative to the average
+    float r = c / ((1.0f + i.gain.load(std::memory_order_relaxed)) * a);
+    unsigned int q = PropCost::AC_MAX;
+    for (float u = Kernel::Config::feedback_unit; (r > u) && (q > 1U); u *= 4.0f)
+      q--;
+    return q;
+  }
+
+
+
   /*
    * Space
    *
@@ -4020,7 +4105,10 @@ namespace Gecode {
   forceinline void
   Space::enqueue(Propagator* p) {
     ActorLink::cast(p)->unlink();
-    ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
+    unsigned int q = p->cost(*this,p->u.med).ac;
+    if ((pc.p.bid_sc & sc_feedback) && (q != PropCost::AC_RECORD))
+      q = ssd.data().gpi.queue(p->gpi(),q);
+    ActorLink* c = &pc.p.queue[q];
     c->tail(ActorLink::cast(p));
     if (c > pc.p.active)
       pc.p.active = c;
@@ -4294,6 +4382,8 @@ namespace Gecode {
   template<class VIC>
   forceinline void
   VarImp<VIC>::schedule(Space& home, PropCond pc1, PropCond pc2, ModEvent me) {
+    if (home.pc.p.bid_sc & (Space::sc_feedback | Space::sc_profile))
+      home.pc.p.n_mod++;
     ActorLink** b = actor(pc1);
     ActorLink** p = actorNonZero(pc2+1);
     while (p-- > b)
@@ -4706,19 +4796,24 @@ namespace Gecode {
   }
 
   forceinline void
-  CloneStatistics::reset(void) {}
+  CloneStatistics::reset(void) {
+    clone = 0; propagator = 0; brancher = 0;
+  }
 
   forceinline
   CloneStatistics::CloneStatistics(void) {
     reset();
   }
   forceinline CloneStatistics
-  CloneStatistics::operator +(const CloneStatistics&) {
-    CloneStatistics s;
-    return s;
+  CloneStatistics::operator +(const CloneStatistics& s) {
+    CloneStatistics t(s);
+    return t += *this;
   }
   forceinline CloneStatistics&
-  CloneStatistics::operator +=(const CloneStatistics&) {
+  CloneStatistics::operator +=(const CloneStatistics& s) {
+    clone += s.clone;
+    propagator += s.propagator;
+    brancher += s.brancher;
     return *this;
   }
 
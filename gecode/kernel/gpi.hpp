@@ -32,6 +32,8 @@
  */
 
 #include <cmath>
+#include <atomic>
+#include <algorithm>
 
 namespace Gecode { namespace Kernel {
 
@@ -47,6 +49,10 @@ namespace Gecode { namespace Kernel {
       unsigned int gid;
       /// The afc value
       double afc;
+      /// Learned cost per execution (in ticks, zero if unknown)
+      std::atomic<float> cost;
+      /// Learned number of variable modifications per execution
+      std::atomic<float> gain;
       /// Initialize
       void init(unsigned int pid, unsigned int gid);
     };
@@ -75,6 +81,8 @@ namespace Gecode { namespace Kernel {
     unsigned int npid;
     /// Whether to unshare
     bool us;
+    /// Learned cost per modification (in ticks) averaged over all propagators
+    std::atomic<float> mc;
     /// The first block
     Block fst;
     /// Mutex to synchronize globally shared access
@@ -88,6 +96,16 @@ namespace Gecode { namespace Kernel {
     double decay(void) const;
     /// Increment failure count
     void fail(Info& c);
+    /// Learn from execution of \a c taking \a t ticks and performing \a m modifications
+    void learn(Info& c, unsigned long long int t, unsigned long int m);
+    /**
+     * \brief Return queue for \a c with static cost \a ac from learned cost
+     *
+     * The queue depends on the learned cost per modification of \a c
+     * relative to the average over all propagators. Hence, it does not
+     * depend on the clock rate of the machine.
+     */
+    unsigned int queue(const Info& c, unsigned int ac) const;
     /// Allocate info for existing propagator with pid \a p
     Info* allocate(unsigned int p, unsigned int gid);
     /// Allocate new actor info
@@ -104,6 +122,35 @@ namespace Gecode { namespace Kernel {
   forceinline void
   GPI::Info::init(unsigned int pid0, unsigned int gid0) {
     pid=pid0; gid=gid0; afc=1.0;
+    cost.store(0.0f,std::memory_order_relaxed);
+    gain.store(0.0f,std::memory_order_relaxed);
+  }
+
+  /*
+   * Cost and gain might be updated concurrently by propagators in
+   * different threads. As they only serve as scheduling heuristic,
+   * lost updates are harmless.
+   */
+  forceinline void
+  GPI::learn(Info& i, unsigned long long int t, unsigned long int m) {
+    float c = i.cost.load(std::memory_order_relaxed);
+    float g = i.gain.load(std::memory_order_relaxed);
+    if (c == 0.0f) {
+      c = static_cast<float>(t); g = static_cast<float>(m);
+    } else {
+      const float d = Kernel::Config::feedback_decay;
+      c = d * c + (1.0f - d) * static_cast<float>(t);
+      g = d * g + (1.0f - d) * static_cast<float>(m);
+    }
+    // Make sure the cost is known from now on
+    i.cost.store(std::max(c,1.0f),std::memory_order_relaxed);
+    i.gain.store(g,std::memory_order_relaxed);
+    // Cost per modification, where executions without modifications count as one
+    float r = static_cast<float>(t) / (1.0f + static_cast<float>(m));
+    float a = mc.load(std::memory_order_relaxed);
+    const float d = Kernel::Config::feedback_mean_decay;
+    mc.store((a == 0.0f) ? r : d * a + (1.0f - d) * r,
+             std::memory_order_relaxed);
   }
 
 
@@ -120,7 +167,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline
   GPI::GPI(void)
-    : b(&fst), invd(1.0), npid(0U), us(false) {}
+    : b(&fst), invd(1.0), npid(0U), us(false), mc(0.0f) {}
 
   forceinline void
   GPI::fail(Info& c) {
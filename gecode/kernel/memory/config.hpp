@@ -43,8 +43,35 @@ namespace Gecode { namespace Kernel {
   namespace MemoryConfig {
     /**
      * \brief How many heap chunks should be cached at most
+     *
+     * This is the size of the cache of a space and its clones (per
+     * NUMA node).
      */
     const unsigned int n_hc_cache = 4*4;
+    /**
+     * \brief High watermark for heap chunks cached per thread
+     *
+     * If a thread caches more heap chunks, the chunks exceeding the
+     * low watermark \a n_hc_thread_low are moved to the cache of the
+     * space and its clones.
+     */
+    const unsigned int n_hc_thread_high = n_hc_cache / 2;
+    /**
+     * \brief Low watermark for heap chunks cached per thread
+     *
+     * If a thread has no cached heap chunk left, it takes up to
+     * \a n_hc_thread_low heap chunks from the cache of the space and
+     * its clones.
+     */
+    const unsigned int n_hc_thread_low = n_hc_thread_high / 2;
+
+    /**
+     * \brief Maximal number of NUMA nodes with separate heap chunk caches
+     *
+     * Each cache holds at most \a n_hc_cache heap chunks. Larger node
+     * numbers share caches.
+     */
+    const unsigned int numa_nodes = 8;
 
     /**
      * \brief Minimal size of a heap chunk requested from the OS
@@ -35,9 +35,263 @@
 
 namespace Gecode { namespace Kernel {
 
-  Support::Mutex& SharedMemory::m(void) {
-    static Support::Mutex _m;
-    return _m;
+  /*
+   * Caching heap chunks
+   *
+   */
+
+  /**
+   * \brief Cache of heap chunks for a single thread
+   *
+   * A magazine only caches heap chunks of a single shared memory (its
+   * owner). Apart from its owner, it is only accessed by its thread
+   * and hence needs no synchronization. All magazines are registered
+   * such that a shared memory can take back its heap chunks when it
+   * is deleted. Changing the owner and deleting a shared memory are
+   * synchronized by the mutex of the registry.
+   */
+  class ChunkMagazine {
+  public:
+    /// Shared memory the cached chunks belong to (NULL if none)
+    std::atomic<SharedMemory*> owner;
+    /// Cached chunks
+    HeapChunk* hc;
+    /// Number of cached chunks
+    unsigned int n;
+    /// Whether the thread caches chunks per NUMA node
+    bool numa;
+    /// NUMA node of the thread (modulo MemoryConfig::numa_nodes)
+    unsigned int node;
+    /// Number of heap chunks reused on the node they have been allocated on
+    unsigned long int local;
+    /// Number of heap chunks released on a different node
+    unsigned long int remote;
+    /// Previous and next magazine in registry
+    ChunkMagazine *prev, *next;
+    /// Initialize as empty and register
+    ChunkMagazine(void);
+    /// Take chunk from magazine
+    HeapChunk* pop(void);
+    /// Put chunk \a c into magazine
+    void push(HeapChunk* c);
+    /// Return all chunks to owner and unregister
+    ~ChunkMagazine(void);
+  };
+
+  /// Registry of all magazines
+  class ChunkRegistry {
+  public:
+    /// Mutex for registry and owners of magazines
+    Support::Mutex m;
+    /// First registered magazine
+    ChunkMagazine* first;
+    /// Initialize as empty
+    ChunkRegistry(void) : first(NULL) {}
+  };
+
+  /// Return the registry of all magazines
+  static ChunkRegistry&
+  registry(void) {
+    static ChunkRegistry r;
+    return r;
+  }
+
+  ChunkMagazine::ChunkMagazine(void)
+    : hc(NULL), n(0U), numa(false), node(0U),
+      local(0UL), remote(0UL), prev(NULL) {
+    owner.store(NULL, std::memory_order_relaxed);
+    ChunkRegistry& r = registry();
+    Support::Lock l(r.m);
+    next = r.first;
+    if (next != NULL)
+      next->prev = this;
+    r.first = this;
+  }
+
+  forceinline HeapChunk*
+  ChunkMagazine::pop(void) {
+    HeapChunk* c = hc;
+    hc = static_cast<HeapChunk*>(c->next); n--;
+    return c;
+  }
+
+  forceinline void
+  ChunkMagazine::push(HeapChunk* c) {
+    c->next = hc; hc = c; n++;
+  }
+
+  ChunkMagazine::~ChunkMagazine(void) {
+    ChunkRegistry& r = registry();
+    Support::Lock l(r.m);
+    if (SharedMemory* sm = owner.load(std::memory_order_relaxed))
+      while (n > 0U)
+        sm->push(pop());
+    if (prev != NULL)
+      prev->next = next;
+    else
+      r.first = next;
+    if (next != NULL)
+      next->prev = prev;
+  }
+
+  /// Return the magazine of the current thread
+  static ChunkMagazine&
+  magazine(void) {
+    static thread_local ChunkMagazine m;
+    return m;
+  }
+
+  /// Return NUMA node of current thread (modulo MemoryConfig::numa_nodes)
+  static unsigned int
+  numa_node(void) {
+    return (Support::Thread::nodes() > 1U) ?
+      (Support::Thread::node() % MemoryConfig::numa_nodes) : 0U;
+  }
+
+  /*
+   * As no links between cached chunks are followed, the cache does
+   * not suffer from the ABA problem.
+   */
+  forceinline HeapChunk*
+  SharedMemory::pop(unsigned int n, size_t l) {
+    for (unsigned int i=0U; i<MemoryConfig::n_hc_cache; i++)
+      if (hc[n][i].load(std::memory_order_relaxed) != NULL) {
+        HeapChunk* c = hc[n][i].exchange(NULL, std::memory_order_acquire);
+        if (c != NULL) {
+          if (c->size >= l)
+            return c;
+          // Too small, give back to the operating system
+          Gecode::heap.rfree(c);
+        }
+      }
+    return NULL;
+  }
+
+  forceinline bool
+  SharedMemory::push(unsigned int n, HeapChunk* c) {
+    for (unsigned int i=0U; i<MemoryConfig::n_hc_cache; i++)
+      if (hc[n][i].load(std::memory_order_relaxed) == NULL) {
+        HeapChunk* e = NULL;
+        if (hc[n][i].compare_exchange_strong(e, c,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed))
+          return true;
+      }
+    return false;
+  }
+
+  void
+  SharedMemory::push(HeapChunk* c) {
+    if (!push(c->node,c))
+      Gecode::heap.rfree(c);
+  }
+
+  SharedMemory::~SharedMemory(void) {
+    {
+      // Take back the chunks from all magazines
+      ChunkRegistry& r = registry();
+      Support::Lock l(r.m);
+      for (ChunkMagazine* m = r.first; m != NULL; m = m->next)
+        if (m->owner.load(std::memory_order_relaxed) == this) {
+          while (m->n > 0U)
+            Gecode::heap.rfree(m->pop());
+          m->owner.store(NULL, std::memory_order_relaxed);
+        }
+    }
+    for (unsigned int n=0U; n<MemoryConfig::numa_nodes; n++)
+      for (unsigned int i=0U; i<MemoryConfig::n_hc_cache; i++)
+        if (HeapChunk* c = hc[n][i].load(std::memory_order_relaxed))
+          Gecode::heap.rfree(c);
+  }
+
+  HeapChunk*
+  SharedMemory::alloc(size_t s, size_t l) {
+    ChunkMagazine& m = magazine();
+    if (m.owner.load(std::memory_order_relaxed) == this) {
+      // Try the magazine of this thread
+      while (m.n > 0U) {
+        HeapChunk* c = m.pop();
+        if (c->size >= l) {
+          m.local++;
+          return c;
+        }
+        Gecode::heap.rfree(c);
+      }
+      // Refill magazine up to the low watermark
+      while (m.n < MemoryConfig::n_hc_thread_low)
+        if (HeapChunk* c = pop(m.node,l))
+          m.push(c);
+        else
+          break;
+      if (m.n > 0U) {
+        m.local++;
+        return m.pop();
+      }
+    } else if (HeapChunk* c = pop(m.node,l)) {
+      m.local++;
+      return c;
+    }
+    HeapChunk* c = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
+    c->size = s;
+    c->node = m.node;
+    return c;
+  }
+
+  void
+  SharedMemory::free(HeapChunk* c) {
+    ChunkMagazine& m = magazine();
+    if (c->node != m.node) {
+      // The chunk has been used on a different node
+      m.remote++;
+      push(c);
+      return;
+    }
+    if (m.owner.load(std::memory_order_relaxed) != this) {
+      // Hand back all chunks of the previous owner and switch owner
+      ChunkRegistry& r = registry();
+      Support::Lock l(r.m);
+      if (SharedMemory* sm = m.owner.load(std::memory_order_relaxed))
+        while (m.n > 0U)
+          sm->push(m.pop());
+      m.owner.store(this, std::memory_order_relaxed);
+    }
+    m.push(c);
+    // Flush magazine down to the low watermark
+    if (m.n > MemoryConfig::n_hc_thread_high)
+      while (m.n > MemoryConfig::n_hc_thread_low)
+        push(m.pop());
+  }
+
+  void
+  SharedMemory::numa(bool b) {
+    ChunkMagazine& m = magazine();
+    if (m.numa == b)
+      return;
+    {
+      // Cached chunks might be allocated on a different node
+      ChunkRegistry& r = registry();
+      Support::Lock l(r.m);
+      if (SharedMemory* sm = m.owner.load(std::memory_order_relaxed))
+        while (m.n > 0U)
+          sm->push(m.pop());
+    }
+    m.numa = b;
+    m.node = b ? numa_node() : 0U;
+  }
+
+  bool
+  SharedMemory::numa(void) {
+    return magazine().numa;
+  }
+
+  unsigned long int
+  SharedMemory::local(void) {
+    return magazine().local;
+  }
+
+  unsigned long int
+  SharedMemory::remote(void) {
+    return magazine().remote;
   }
 
   void
@@ -38,6 +38,8 @@
  *
  */
 
+#include <atomic>
+
 namespace Gecode { namespace Kernel {
 
   /// Memory chunk with size information
@@ -52,33 +54,62 @@ namespace Gecode { namespace Kernel {
   /// Memory chunk allocated from heap with proper alignment
   class HeapChunk : public MemoryChunk {
   public:
+    /// NUMA node (modulo MemoryConfig::numa_nodes) the chunk has been allocated on
+    unsigned int node;
     /// Start of memory area inside chunk
     double area[1];
   };
 
-  /// Shared object for several memory areas
+  /**
+   * \brief Shared object for several memory areas
+   *
+   * Heap chunks are cached in two levels without any locking in the
+   * common case: each thread has a small cache (a magazine) for the
+   * shared memory it has used last (see MemoryConfig::n_hc_thread_high
+   * and MemoryConfig::n_hc_thread_low), which is refilled from and
+   * flushed to slots shared by all spaces sharing the memory (a space
+   * and its clones, see MemoryConfig::n_hc_cache). The slots are only
+   * accessed by atomic exchange and compare-and-swap operations.
+   *
+   * If the current thread is NUMA-aware, its magazine only holds heap
+   * chunks allocated on its NUMA node and a heap chunk is only ever
+   * cached in the slots for the node where it has been allocated (and
+   * hence first touched). Otherwise, the slots for node 0 are used.
+   */
   class SharedMemory {
+    friend class ChunkMagazine;
   private:
-    /// The components for shared heap memory
-    struct {
-      /// How many heap chunks are available for caching
-      unsigned int n_hc;
-      /// A list of cached heap chunks
-      HeapChunk* hc;
-    } heap;
-    /// A mutex for access
-    GECODE_KERNEL_EXPORT static Support::Mutex& m(void);
+    /// The slots of cached heap chunks for all NUMA nodes
+    std::atomic<HeapChunk*> hc[MemoryConfig::numa_nodes]
+                              [MemoryConfig::n_hc_cache];
+    /// Return chunk of size at least \a l cached for node \a n or NULL
+    HeapChunk* pop(unsigned int n, size_t l);
+    /// Cache chunk \a c for node \a n, return false if no slot is free
+    bool push(unsigned int n, HeapChunk* c);
+    /// Cache chunk \a c (or free it if no slot is free)
+    void push(HeapChunk* c);
   public:
     /// Initialize
     SharedMemory(void);
-    /// Destructor
-    ~SharedMemory(void);
+    /// Release all cached heap chunks (including those in magazines)
+    GECODE_KERNEL_EXPORT ~SharedMemory(void);
     /// \name Heap management
     //@
     /// Return heap chunk, preferable of size \a s, but at least of size \a l
-    HeapChunk* alloc(size_t s, size_t l);
+    GECODE_KERNEL_EXPORT HeapChunk* alloc(size_t s, size_t l);
     /// Free heap chunk (or cache for later)
-    void free(HeapChunk* hc);
+    GECODE_KERNEL_EXPORT void free(HeapChunk* hc);
+    //@}
+    /// \name NUMA support
+    //@{
+    /// Set whether the current thread caches heap chunks per NUMA node
+    GECODE_KERNEL_EXPORT static void numa(bool b);
+    /// Return whether the current thread caches heap chunks per NUMA node
+    GECODE_KERNEL_EXPORT static bool numa(void);
+    /// Return number of heap chunks the current thread reused on the node they have been allocated on
+    GECODE_KERNEL_EXPORT static unsigned long int local(void);
+    /// Return number of heap chunks the current thread released on a different node than allocated on (in NUMA-aware mode)
+    GECODE_KERNEL_EXPORT static unsigned long int remote(void);
     //@}
   };
 
@@ -182,51 +213,10 @@ namespace Gecode { namespace Kernel {
 
   forceinline
   SharedMemory::SharedMemory(void) {
-    heap.n_hc = 0;
-    heap.hc = NULL;
+    for (unsigned int n=0U; n<MemoryConfig::numa_nodes; n++)
+      for (unsigned int i=0U; i<MemoryConfig::n_hc_cache; i++)
+        hc[n][i].store(NULL, std::memory_order_relaxed);
   }
-  forceinline
-  SharedMemory::~SharedMemory(void) {
-    while (heap.hc != NULL) {
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      Gecode::heap.rfree(hc);
-    }
-  }
-
-  forceinline HeapChunk*
-  SharedMemory::alloc(size_t s, size_t l) {
-    // To protect from exceptions from heap.ralloc()
-    Support::Lock guard(m());
-    while ((heap.hc != NULL) && (heap.hc->size < l)) {
-      heap.n_hc--;
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      Gecode::heap.rfree(hc);
-    }
-    HeapChunk* hc;
-    if (heap.hc == NULL) {
-      assert(heap.n_hc == 0);
-      hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
-      hc->size = s;
-    } else {
-      heap.n_hc--;
-      hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-    }
-    return hc;
-  }
-  forceinline void
-  SharedMemory::free(HeapChunk* hc) {
-    Support::Lock guard(m());
-    if (heap.n_hc == MemoryConfig::n_hc_cache) {
-      Gecode::heap.rfree(hc);
-    } else {
-      heap.n_hc++;
-      hc->next = heap.hc; heap.hc = hc;
-    }
-  }
-
 
 }}
 
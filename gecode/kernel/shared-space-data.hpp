@@ -31,6 +31,12 @@
  *
  */
 
+namespace Gecode {
+
+  class PropagatorProfiler;
+
+}
+
 namespace Gecode { namespace Kernel {
 
   /// Class to store data shared among several spaces
@@ -43,6 +49,8 @@ namespace Gecode { namespace Kernel {
       SharedMemory sm;
       /// The global propagator information
       GPI gpi;
+      /// The propagator profiler (NULL if propagation is not profiled)
+      PropagatorProfiler* profiler;
       /// Default constructor
       Data(void);
       /// Destructor
@@ -63,7 +71,7 @@ namespace Gecode { namespace Kernel {
 
 
   forceinline
-  SharedSpaceData::Data::Data(void) {}
+  SharedSpaceData::Data::Data(void) : profiler(NULL) {}
 
   forceinline
   SharedSpaceData::Data::~Data(void) {}
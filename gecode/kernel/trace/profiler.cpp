@@ -0,0 +1,184 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/kernel.hh>
+
+#include <cstring>
+#include <typeinfo>
+#include <iostream>
+#include <string>
+
+#ifdef __GNUC__
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+namespace Gecode {
+
+  namespace {
+
+    /// Order entries by decreasing ticks
+    class ByTicks {
+    public:
+      /// Test whether \a x has been more expensive than \a y
+      bool operator ()(const PropagatorProfiler::Entry* x,
+                       const PropagatorProfiler::Entry* y) const {
+        return x->ticks.load() > y->ticks.load();
+      }
+    };
+
+    /// Return demangled name of propagator class of \a e
+    std::string
+    name(const PropagatorProfiler::Entry& e) {
+#ifdef __GNUC__
+      int s = 0;
+      char* d = abi::__cxa_demangle(e.type,NULL,NULL,&s);
+      if ((s == 0) && (d != NULL)) {
+        std::string r(d);
+        std::free(d);
+        return r;
+      }
+#endif
+      return e.type;
+    }
+
+  }
+
+  PropagatorProfiler::PropagatorProfiler(void)
+    : overflow(new Entry(typeid(Propagator).name(),0U)) {
+    for (unsigned int i=0; i<n_entries; i++)
+      e[i].store(NULL);
+    t.start();
+    t0 = Support::ticks();
+  }
+
+  PropagatorProfiler::Entry&
+  PropagatorProfiler::entry(const Propagator& p) {
+    const std::type_info& t = typeid(p);
+    unsigned int g = p.group().id();
+    unsigned int h =
+      static_cast<unsigned int>(t.hash_code() ^ (g * 0x9e3779b9U));
+    for (unsigned int i=0; i<n_entries; i++) {
+      std::atomic<Entry*>& s = e[(h + i) & (n_entries-1)];
+      Entry* f = s.load(std::memory_order_acquire);
+      if (f == NULL) {
+        // Try to claim the empty slot
+        Entry* n = new Entry(t.name(),g);
+        if (s.compare_exchange_strong(f,n,std::memory_order_acq_rel))
+          return *n;
+        // Some other thread has been quicker
+        delete n;
+      }
+      if ((f->gid == g) &&
+          ((f->type == t.name()) || (std::strcmp(f->type,t.name()) == 0)))
+        return *f;
+    }
+    return *overflow;
+  }
+
+  double
+  PropagatorProfiler::ms(void) {
+    unsigned long long int n = Support::ticks() - t0;
+    double m = t.stop();
+    return (n > 0ULL) ? m / static_cast<double>(n) : 0.0;
+  }
+
+  PropagatorProfiler::Entry**
+  PropagatorProfiler::sorted(Region& r, int& n) {
+    Entry** es = r.alloc<Entry*>(n_entries+1);
+    n = 0;
+    for (unsigned int i=0; i<n_entries; i++)
+      if (Entry* x = e[i].load())
+        es[n++] = x;
+    if (overflow->calls.load() > 0UL)
+      es[n++] = overflow;
+    ByTicks bt;
+    Support::quicksort(es,n,bt);
+    return es;
+  }
+
+  void
+  PropagatorProfiler::csv(std::ostream& os) {
+    double f = ms();
+    Region r;
+    int n;
+    Entry** es = sorted(r,n);
+    os << "propagator,group,calls,ms,fix,nofix,subsumed,failed,modified"
+       << std::endl;
+    for (int i=0; i<n; i++) {
+      std::string p = name(*es[i]);
+      // Template arguments contain commas
+      os << '"' << p << "\","
+         << es[i]->gid << ','
+         << es[i]->calls.load() << ','
+         << f * static_cast<double>(es[i]->ticks.load()) << ','
+         << es[i]->fix.load() << ','
+         << es[i]->nofix.load() << ','
+         << es[i]->subsumed.load() << ','
+         << es[i]->failed.load() << ','
+         << es[i]->modified.load() << std::endl;
+    }
+  }
+
+  void
+  PropagatorProfiler::json(std::ostream& os) {
+    double f = ms();
+    Region r;
+    int n;
+    Entry** es = sorted(r,n);
+    os << "[";
+    for (int i=0; i<n; i++) {
+      std::string p = name(*es[i]);
+      os << ((i > 0) ? ",\n " : "\n ")
+         << "{\"propagator\": \"";
+      for (std::string::size_type j=0; j<p.size(); j++) {
+        if ((p[j] == '"') || (p[j] == '\\'))
+          os << '\\';
+        os << p[j];
+      }
+      os << "\", \"group\": " << es[i]->gid
+         << ", \"calls\": " << es[i]->calls.load()
+         << ", \"ms\": " << f * static_cast<double>(es[i]->ticks.load())
+         << ", \"fix\": " << es[i]->fix.load()
+         << ", \"nofix\": " << es[i]->nofix.load()
+         << ", \"subsumed\": " << es[i]->subsumed.load()
+         << ", \"failed\": " << es[i]->failed.load()
+         << ", \"modified\": " << es[i]->modified.load() << "}";
+    }
+    os << "\n]" << std::endl;
+  }
+
+  PropagatorProfiler::~PropagatorProfiler(void) {
+    for (unsigned int i=0; i<n_entries; i++)
+      delete e[i].load();
+    delete overflow;
+  }
+
+}
+
+// STATISTICS: kernel-trace
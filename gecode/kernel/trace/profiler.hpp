@@ -0,0 +1,132 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <atomic>
+#include <iosfwd>
+
+namespace Gecode {
+
+  /**
+   * \brief Profiler for propagator executions
+   *
+   * The profiler aggregates all executions of propagators per
+   * propagator class and propagator group: the number of executions,
+   * the time spent (measured by Support::ticks), how often each
+   * execution status has been returned, and how many variable
+   * modifications have been performed.
+   *
+   * A profiler can be shared by spaces that are used by different
+   * threads (for example, by the clones in a parallel search engine).
+   * It must outlive all spaces that use it.
+   *
+   * \ingroup TaskTrace
+   */
+  class GECODE_KERNEL_EXPORT PropagatorProfiler : public HeapAllocated {
+  public:
+    /// Aggregated information for a propagator class in a group
+    class Entry : public HeapAllocated {
+    public:
+      /// Mangled name of propagator class
+      const char* type;
+      /// Propagator group identifier
+      unsigned int gid;
+      /// Number of executions
+      std::atomic<unsigned long int> calls;
+      /// Ticks spent during execution
+      std::atomic<unsigned long long int> ticks;
+      /// Number of executions returning fixpoint
+      std::atomic<unsigned long int> fix;
+      /// Number of executions returning no fixpoint
+      std::atomic<unsigned long int> nofix;
+      /// Number of executions returning subsumption
+      std::atomic<unsigned long int> subsumed;
+      /// Number of executions returning failure
+      std::atomic<unsigned long int> failed;
+      /// Number of variable modifications
+      std::atomic<unsigned long int> modified;
+      /// Initialize for propagator class with mangled name \a t and group \a g
+      Entry(const char* t, unsigned int g);
+      /// Record execution with status \a es, \a t ticks, and \a m modifications
+      void record(ExecStatus es, unsigned long long int t,
+                  unsigned long int m);
+    };
+  protected:
+    /// Number of entries in the hash table (a power of two)
+    static const unsigned int n_entries = 1024U;
+    /// Hash table of entries
+    std::atomic<Entry*> e[n_entries];
+    /// Entry for all propagators not fitting into the hash table
+    Entry* overflow;
+    /// Timer started when the profiler was created
+    Support::Timer t;
+    /// Ticks when the profiler was created
+    unsigned long long int t0;
+    /// Return milliseconds per tick
+    double ms(void);
+    /// Return entries allocated from \a r sorted by decreasing ticks, \a n is their number
+    Entry** sorted(Region& r, int& n);
+  public:
+    /// Initialize empty profiler
+    PropagatorProfiler(void);
+    /// Return entry for propagator \a p
+    Entry& entry(const Propagator& p);
+    /// Print profile as comma-separated values to \a os
+    void csv(std::ostream& os);
+    /// Print profile as JSON to \a os
+    void json(std::ostream& os);
+    /// Delete profiler
+    ~PropagatorProfiler(void);
+  };
+
+
+  forceinline
+  PropagatorProfiler::Entry::Entry(const char* t, unsigned int g)
+    : type(t), gid(g), calls(0UL), ticks(0ULL),
+      fix(0UL), nofix(0UL), subsumed(0UL), failed(0UL), modified(0UL) {}
+
+  forceinline void
+  PropagatorProfiler::Entry::record(ExecStatus es, unsigned long long int t,
+                                    unsigned long int m) {
+    calls.fetch_add(1UL,std::memory_order_relaxed);
+    ticks.fetch_add(t,std::memory_order_relaxed);
+    modified.fetch_add(m,std::memory_order_relaxed);
+    switch (es) {
+    case ES_FAILED:
+      failed.fetch_add(1UL,std::memory_order_relaxed); break;
+    case ES_FIX:
+      fix.fetch_add(1UL,std::memory_order_relaxed); break;
+    case __ES_SUBSUMED:
+      subsumed.fetch_add(1UL,std::memory_order_relaxed); break;
+    default:
+      nofix.fetch_add(1UL,std::memory_order_relaxed); break;
+    }
+  }
+
+}
+
+// STATISTICS: kernel-trace
@@ -129,6 +129,17 @@ namespace Gecode { namespace Search {
 
     /// Depth limit for no-good generation during search
     const unsigned int nogoods_limit = 128;
+    /// Depth limit for no-goods exchanged between assets of a portfolio
+    const unsigned int exchange_limit = 16;
+    /// Number of restarts between exchanges of no-goods
+    const unsigned int exchange_restarts = 1;
+
+    /// Number of open nodes per worker process for distributed search
+    const unsigned int dist_units = 16;
+    /// Number of nodes between checking for messages in worker processes
+    const unsigned int dist_poll = 64;
+    /// Number of nodes between reporting statistics by worker processes
+    const unsigned int dist_report = 1024;
 
     /// Default port for CPProfiler
     const unsigned int cpprofiler_port = 6565U;
@@ -144,7 +155,7 @@ namespace Gecode { namespace Search {
    * \brief %Search engine statistics
    * \ingroup TaskModelSearch
    */
-  class Statistics : public StatusStatistics {
+  class Statistics : public StatusStatistics, public CloneStatistics {
   public:
     /// Number of failed nodes in search tree
     unsigned long int fail;
@@ -156,6 +167,10 @@ namespace Gecode { namespace Search {
     unsigned long int restart;
     /// Number of no-goods posted
     unsigned long int nogood;
+    /// Number of heap chunks reused on the NUMA node they have been allocated on (parallel search with NUMA only)
+    unsigned long int numa_local;
+    /// Number of heap chunks released on a different NUMA node than allocated on (parallel search with NUMA only)
+    unsigned long int numa_remote;
     /// Initialize
     Statistics(void);
     /// Reset
@@ -705,6 +720,7 @@ namespace Gecode { namespace Search {
 namespace Gecode { namespace Search {
 
     class Stop;
+    class Exchange;
 
     /**
      * \brief %Search engine options
@@ -749,6 +765,13 @@ namespace Gecode { namespace Search {
       bool clone;
       /// Number of threads to use
       double threads;
+      /**
+       * \brief Number of worker processes for distributed %DFS and %BAB search (0 = none)
+       *
+       * Worker processes can only be created if the process runs no
+       * threads other than idle threads of parallel search.
+       */
+      unsigned int processes;
       /// Create a clone after every \a c_d commits (commit distance)
       unsigned int c_d;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
@@ -761,12 +784,18 @@ namespace Gecode { namespace Search {
       unsigned int slice;
       /// Depth limit for extraction of no-goods
       unsigned int nogoods_limit;
+      /// Whether parallel engines use randomized non-blocking work stealing
+      bool work_stealing;
+      /// Whether parallel engines cache memory per NUMA node and bind threads to nodes
+      bool numa;
       /// Stop object for stopping search
       Stop* stop;
       /// Cutoff for restart-based search
       Cutoff* cutoff;
       /// Tracer object for tracing search
       SearchTracer* tracer;
+      /// Exchange of no-goods between restart-based assets of a portfolio
+      Exchange* exchange;
       /// Default options
       GECODE_SEARCH_EXPORT static const Options def;
       /// Initialize with default values
@@ -891,6 +920,83 @@ namespace Gecode { namespace Search {
 
 #include <gecode/search/stop.hpp>
 
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Exchange of no-goods between assets of a portfolio
+   *
+   * An exchange object can be passed (as option \a exchange) to the
+   * restart-based engines that are assets of a portfolio. At each
+   * restart, an asset publishes the no-goods it has learned and posts
+   * the no-goods published by the other assets meanwhile.
+   *
+   * No-goods are exchanged as archived paths. Only the choices of
+   * branchers that exist in the master space of the portfolio can be
+   * exchanged, a path is cut at the first choice of a brancher that
+   * has been created later (for example, by the slave function of an
+   * asset). Hence, exchanging no-goods is only sound if the slave
+   * functions do not post propagators but at most branchers.
+   *
+   * At most Exchange::n_entries paths are kept, older paths are
+   * overwritten. The exchange object is not deleted by the engines.
+   *
+   * \ingroup TaskModelSearch
+   */
+  class GECODE_SEARCH_EXPORT Exchange : public HeapAllocated {
+  public:
+    /// Maximal number of paths kept
+    static const unsigned int n_entries = 64U;
+  protected:
+    /// Published path
+    class Entry {
+    public:
+      /// Asset that published the path
+      unsigned int asset;
+      /// The archived path
+      Archive path;
+    };
+    /// Mutex for access
+    Support::Mutex m;
+    /// The published paths
+    Entry entries[n_entries];
+    /// Number of assets that have subscribed
+    unsigned int n_assets;
+    /// Number of paths published so far
+    unsigned long int n;
+    /// Brancher identities smaller than \a bid can be exchanged
+    unsigned int bid;
+    /// Depth limit for exchanged paths
+    unsigned int l;
+    /// Number of restarts between exchanges
+    unsigned int r;
+  public:
+    /// Initialize with depth limit \a l and exchange at every \a r-th restart
+    Exchange(unsigned int l=Config::exchange_limit,
+             unsigned int r=Config::exchange_restarts);
+    /// Return depth limit for exchanged paths
+    unsigned int limit(void) const;
+    /// Return number of restarts between exchanges
+    unsigned int restarts(void) const;
+    /// Only exchange choices of branchers of the master space \a home
+    void branchers(Space& home);
+    /// Subscribe a new asset and return its number
+    unsigned int subscribe(void);
+    /// Publish archived path \a e by asset \a a
+    void publish(unsigned int a, const Archive& e);
+    /**
+     * \brief Post no-goods from paths of other assets than \a a to \a home
+     *
+     * Only paths published since the \a i-th path are posted and \a i
+     * is updated. Returns the number of no-goods posted.
+     */
+    unsigned long int post(Space& home, unsigned int a,
+                           unsigned long int& i);
+    /// Destructor
+    virtual ~Exchange(void);
+  };
+
+}}
+
 namespace Gecode { namespace Search {
 
   /**
@@ -35,6 +35,7 @@
 #include <gecode/search/support.hh>
 
 #include <gecode/search/seq/dfs.hh>
+#include <gecode/search/dist/engine.hh>
 #ifdef GECODE_HAS_THREADS
 #include <gecode/search/par/dfs.hh>
 #endif
@@ -43,6 +44,10 @@ namespace Gecode { namespace Search {
 
   Engine*
   dfsengine(Space* s, const Options& o) {
+#ifdef GECODE_HAS_PROCESSES
+    if (o.processes > 0U)
+      return new Dist::Engine(s,o,false);
+#endif
 #ifdef GECODE_HAS_THREADS
     Options to = o.expand();
     if (to.threads == 1.0) {
@@ -0,0 +1,715 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/dist/engine.hh>
+
+#ifdef GECODE_HAS_PROCESSES
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <poll.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#ifndef MSG_NOSIGNAL
+// Sockets are configured by SO_NOSIGPIPE instead
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace Gecode { namespace Search { namespace Dist {
+
+  /*
+   * Sending and receiving words through sockets
+   *
+   */
+
+  Buffer::Buffer(void) : w(NULL), n(0U), l(0U), s(0) {}
+
+  void
+  Buffer::add(unsigned int x) {
+    if (n == l) {
+      unsigned int m = std::max(2U*l,16U);
+      w = heap.realloc<unsigned int>(w,l,m);
+      l = m;
+    }
+    w[n++] = x;
+  }
+
+  void
+  Buffer::add(unsigned long int x) {
+    unsigned long long int y = x;
+    add(static_cast<unsigned int>(y >> 32));
+    add(static_cast<unsigned int>(y & 0xffffffffULL));
+  }
+
+  bool
+  Buffer::empty(void) const {
+    return n == 0U;
+  }
+
+  bool
+  Buffer::send(int fd, bool block) {
+    const char* b = reinterpret_cast<const char*>(w);
+    size_t t = n * sizeof(unsigned int);
+    // A terminated process yields EPIPE rather than SIGPIPE
+    int f = block ? MSG_NOSIGNAL : (MSG_NOSIGNAL | MSG_DONTWAIT);
+    while (s < t) {
+      ssize_t k = ::send(fd, b+s, t-s, f);
+      if (k < 0) {
+        if (errno == EINTR)
+          continue;
+        if (!block && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+          return false;
+        throw ProcessFailure("Search::Dist::Buffer::send");
+      }
+      s += static_cast<size_t>(k);
+    }
+    n = 0U; s = 0;
+    return true;
+  }
+
+  Buffer::~Buffer(void) {
+    heap.free<unsigned int>(w,l);
+  }
+
+  /// Read \a n words from \a fd into \a w, return false if closed
+  static bool
+  get(int fd, unsigned int* w, size_t n) {
+    char* b = reinterpret_cast<char*>(w);
+    size_t l = n * sizeof(unsigned int);
+    while (l > 0) {
+      ssize_t k = ::read(fd, b, l);
+      if (k < 0) {
+        if (errno == EINTR)
+          continue;
+        throw ProcessFailure("Search::Dist::get");
+      }
+      if (k == 0)
+        return false;
+      b += k; l -= static_cast<size_t>(k);
+    }
+    return true;
+  }
+
+  /// Read word from \a fd (the socket must not be closed)
+  forceinline unsigned int
+  get(int fd) {
+    unsigned int w;
+    if (!get(fd, &w, 1))
+      throw ProcessFailure("Search::Dist::get");
+    return w;
+  }
+
+  /// Read two words from \a fd as unsigned long integer
+  forceinline unsigned long int
+  getl(int fd) {
+    unsigned long long int h = get(fd);
+    unsigned long long int l = get(fd);
+    return static_cast<unsigned long int>((h << 32) | l);
+  }
+
+  /// Check without waiting whether \a fd can be read (or is closed)
+  forceinline bool
+  readable(int fd) {
+    struct pollfd pfd;
+    pfd.fd = fd; pfd.events = POLLIN; pfd.revents = 0;
+    return ::poll(&pfd, 1, 0) > 0;
+  }
+
+  /// Add statistics \a t to buffer \a b
+  static void
+  putstat(Buffer& b, const Statistics& t) {
+    b.add(t.fail); b.add(t.node); b.add(t.depth);
+    b.add(t.restart); b.add(t.nogood); b.add(t.propagate);
+    b.add(t.clone); b.add(t.propagator); b.add(t.brancher);
+  }
+
+  /// Read statistics from \a fd
+  static Statistics
+  getstat(int fd) {
+    Statistics t;
+    t.fail = getl(fd); t.node = getl(fd); t.depth = getl(fd);
+    t.restart = getl(fd); t.nogood = getl(fd); t.propagate = getl(fd);
+    t.clone = getl(fd); t.propagator = getl(fd); t.brancher = getl(fd);
+    return t;
+  }
+
+  /// Test whether the process runs threads other than the calling and idle ones
+  static bool
+  threads(void) {
+#if defined(__linux__) && defined(GECODE_HAS_THREADS)
+    // Threads that just finished parallel search might not yet be idle
+    for (unsigned int k=0U; k<10U; k++) {
+      unsigned long int n = 0UL;
+      std::ifstream f("/proc/self/status");
+      std::string l;
+      while (std::getline(f,l))
+        if (l.compare(0,8,"Threads:") == 0) {
+          n = std::strtoul(l.c_str()+8,NULL,10);
+          break;
+        }
+      if (n <= 1UL + Support::Thread::pooled())
+        return false;
+      Support::Thread::sleep(10);
+    }
+    return true;
+#else
+    // No information available
+    return false;
+#endif
+  }
+
+
+  /*
+   * Paths
+   *
+   */
+
+  Path::Path(void) : n(0) {}
+
+  unsigned int
+  Path::edges(void) const {
+    return n;
+  }
+
+  void
+  Path::push(const Archive& c, unsigned int alt) {
+    a << alt << c.size();
+    for (int i=0; i<c.size(); i++)
+      a << c[i];
+    n++;
+  }
+
+  void
+  Path::push(const Choice& c, unsigned int alt) {
+    Archive e;
+    c.archive(e);
+    push(e,alt);
+  }
+
+  Space*
+  Path::replay(const Space& root) const {
+    Space* s = root.clone();
+    int j = 0;
+    for (unsigned int i=0U; i<n; i++) {
+      unsigned int alt = a[j++];
+      int l = static_cast<int>(a[j++]);
+      Archive e;
+      for (int k=0; k<l; k++)
+        e << a[j++];
+      const Choice* c = s->choice(e);
+      s->commit(*c,alt);
+      delete c;
+    }
+    return s;
+  }
+
+  void
+  Path::write(Buffer& b) const {
+    b.add(n); b.add(static_cast<unsigned int>(a.size()));
+    for (int i=0; i<a.size(); i++)
+      b.add(a[i]);
+  }
+
+  bool
+  Path::read(int fd) {
+    unsigned int h[2];
+    if (!get(fd, h, 2))
+      return false;
+    n = h[0];
+    a = Archive();
+    if (h[1] > 0U) {
+      unsigned int* w = heap.alloc<unsigned int>(h[1]);
+      if (!get(fd, w, h[1]))
+        throw ProcessFailure("Search::Dist::Path::read");
+      for (unsigned int i=0U; i<h[1]; i++)
+        a << w[i];
+      heap.free<unsigned int>(w,h[1]);
+    }
+    return true;
+  }
+
+
+  /*
+   * The engine
+   *
+   */
+
+  Engine::Engine(Space* s, const Options& o, bool b0)
+    : opt(o), best(b0), root(NULL), b(NULL),
+      open(heap), solutions(heap),
+      p(NULL), n_p(0U), _stopped(false) {
+    if (threads())
+      throw ProcessFailure("Search::Dist::Engine::Engine");
+    switch (s->status(stat)) {
+    case SS_FAILED:
+      stat.fail++;
+      if (!opt.clone)
+        delete s;
+      break;
+    case SS_SOLVED:
+      root = snapshot(s,opt);
+      solution(root->clone());
+      break;
+    case SS_BRANCH:
+      root = snapshot(s,opt);
+      split();
+      if (!open.empty()) {
+        try {
+          fork();
+        } catch (...) {
+          // The destructor is not run
+          while (!open.empty())
+            delete open.pop();
+          while (!solutions.empty())
+            delete solutions.pop();
+          delete b;
+          delete root;
+          throw;
+        }
+      }
+      break;
+    default:
+      GECODE_NEVER;
+    }
+  }
+
+  void
+  Engine::solution(Space* s) {
+    // Deletes all pending branchers
+    (void) s->choice();
+    if (best) {
+      delete b;
+      b = s->clone();
+    }
+    solutions.push(s);
+  }
+
+  void
+  Engine::split(void) {
+    /// Node to be expanded together with its path
+    class Node {
+    public:
+      /// Path to node
+      Path* p;
+      /// Propagated space for node
+      Space* s;
+    };
+    Support::DynamicQueue<Node,Heap> q(heap);
+    unsigned int n_q = 0U;
+    {
+      Node r;
+      r.p = new Path; r.s = root->clone();
+      q.push(r); n_q++;
+    }
+    unsigned int n_open = std::max(opt.processes,1U) * Config::dist_units;
+    // Expand breadth-first until there are sufficiently many open nodes
+    while (!q.empty() && (n_q < n_open)) {
+      Node x = q.pop(); n_q--;
+      const Choice* c = x.s->choice();
+      unsigned int n_a = c->alternatives();
+      for (unsigned int a=0U; a<n_a; a++) {
+        Space* s = (a+1U < n_a) ? x.s->clone(stat) : x.s;
+        s->commit(*c,a);
+        if (best && (b != NULL))
+          s->constrain(*b);
+        stat.node++;
+        switch (s->status(stat)) {
+        case SS_FAILED:
+          stat.fail++;
+          delete s;
+          break;
+        case SS_SOLVED:
+          solution(s);
+          break;
+        case SS_BRANCH:
+          {
+            Node y;
+            y.p = new Path(*x.p); y.p->push(*c,a);
+            y.s = s;
+            q.push(y); n_q++;
+            stat.depth = std::max(stat.depth,
+                                  static_cast<unsigned long int>
+                                  (y.p->edges()));
+          }
+          break;
+        default:
+          GECODE_NEVER;
+        }
+      }
+      delete c;
+      delete x.p;
+    }
+    // The remaining nodes are handed out to the workers
+    while (!q.empty()) {
+      Node x = q.pop();
+      delete x.s;
+      open.push(x.p);
+    }
+  }
+
+  void
+  Engine::fork(void) {
+    n_p = std::max(opt.processes,1U);
+    p = heap.alloc<Process>(n_p);
+    for (unsigned int i=0U; i<n_p; i++) {
+      int sv[2];
+      pid_t pid = -1;
+      if (::socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == 0) {
+#ifdef SO_NOSIGPIPE
+        int one = 1;
+        (void) ::setsockopt(sv[0], SOL_SOCKET, SO_NOSIGPIPE,
+                            &one, sizeof(one));
+        (void) ::setsockopt(sv[1], SOL_SOCKET, SO_NOSIGPIPE,
+                            &one, sizeof(one));
+#endif
+        pid = ::fork();
+        if (pid < 0) {
+          ::close(sv[0]); ::close(sv[1]);
+        }
+      }
+      if (pid < 0) {
+        // Terminate the workers created so far
+        for (unsigned int j=0U; j<i; j++) {
+          ::close(p[j].fd);
+          (void) ::kill(static_cast<pid_t>(p[j].pid), SIGKILL);
+          int status;
+          (void) ::waitpid(static_cast<pid_t>(p[j].pid), &status, 0);
+        }
+        heap.free<Process>(p,n_p);
+        p = NULL; n_p = 0U;
+        throw ProcessFailure("Search::Dist::Engine::fork");
+      }
+      if (pid == 0) {
+        // The worker only keeps its own end of its own socket
+        for (unsigned int j=0U; j<i; j++)
+          ::close(p[j].fd);
+        ::close(sv[0]);
+        // The worker must never return into the code of the engine
+        try {
+          work(sv[1]);
+        } catch (...) {
+          ::_exit(1);
+        }
+        ::_exit(0);
+      }
+      ::close(sv[1]);
+      p[i].pid = static_cast<int>(pid);
+      p[i].fd = sv[0];
+      p[i].busy = false;
+      p[i].paused = false;
+    }
+  }
+
+  void
+  Engine::bound(int fd, Space*& w_b, unsigned int& w_v) {
+    Path bp;
+    (void) bp.read(fd);
+    Space* s = bp.replay(*root);
+    // Only a better solution replaces the worker's own best solution
+    if (w_b != NULL)
+      s->constrain(*w_b);
+    // Replaying is not part of the search statistics
+    StatusStatistics t;
+    if (s->status(t) == SS_SOLVED) {
+      (void) s->choice();
+      delete w_b; w_b = s; w_v++;
+    } else {
+      delete s;
+    }
+  }
+
+  void
+  Engine::work(int fd) {
+    /// Edge in the search tree explored by the worker
+    class Edge {
+    public:
+      /// Propagated space (NULL if last alternative is explored)
+      Space* s;
+      /// Choice
+      const Choice* c;
+      /// Alternative explored
+      unsigned int alt;
+      /// Version of best solution the space is constrained by
+      unsigned int v;
+    };
+    Support::DynamicStack<Edge,Heap> ds(heap);
+    // Best solution and its version (the best solution is inherited)
+    Space* w_b = (b != NULL) ? b->clone() : NULL;
+    unsigned int w_v = 0U;
+    Path path;
+    // Messages are sent with blocking: the engine never blocks
+    Buffer out;
+    while (true) {
+      unsigned int m;
+      if (!get(fd, &m, 1))
+        return;
+      switch (m) {
+      case M_STOP:
+        return;
+      case M_BOUND:
+        bound(fd,w_b,w_v);
+        break;
+      case M_WORK:
+        {
+          Statistics t;
+          (void) path.read(fd);
+          Space* cur = path.replay(*root);
+          unsigned int cur_v = ~0U;
+          unsigned int n = 0U;
+          while (true) {
+            // Check for messages from time to time
+            if ((++n % Config::dist_poll == 0U) && readable(fd)) {
+              unsigned int mm;
+              if (!get(fd, &mm, 1) || (mm == M_STOP))
+                return;
+              assert(mm == M_BOUND);
+              bound(fd,w_b,w_v);
+            }
+            // Report statistics from time to time
+            if (n % Config::dist_report == 0U) {
+              out.add(static_cast<unsigned int>(M_STATISTICS));
+              putstat(out,t);
+              (void) out.send(fd,true);
+              t.reset();
+            }
+            if (cur != NULL) {
+              if (best && (w_b != NULL) && (cur_v != w_v)) {
+                cur->constrain(*w_b); cur_v = w_v;
+              }
+              t.node++;
+              switch (cur->status(t)) {
+              case SS_FAILED:
+                t.fail++;
+                delete cur;
+                cur = NULL;
+                break;
+              case SS_SOLVED:
+                {
+                  Path sp(path);
+                  for (int i=0; i<ds.entries(); i++)
+                    sp.push(*ds[i].c,ds[i].alt);
+                  out.add(static_cast<unsigned int>(M_SOLUTION));
+                  sp.write(out);
+                  (void) out.send(fd,true);
+                  if (best) {
+                    (void) cur->choice();
+                    delete w_b; w_b = cur; w_v++;
+                  } else {
+                    delete cur;
+                    // Wait until the engine is asked for a further solution
+                    unsigned int mm;
+                    if (!get(fd, &mm, 1) || (mm == M_STOP))
+                      return;
+                    assert(mm == M_CONTINUE);
+                  }
+                  cur = NULL;
+                }
+                break;
+              case SS_BRANCH:
+                {
+                  Edge e;
+                  e.s = cur; e.c = cur->choice(); e.alt = 0U; e.v = cur_v;
+                  ds.push(e);
+                  t.depth = std::max(t.depth,
+                                     static_cast<unsigned long int>
+                                     (path.edges() + ds.entries()));
+                  cur = e.s->clone(t);
+                  cur->commit(*e.c,0U);
+                }
+                break;
+              default:
+                GECODE_NEVER;
+              }
+            } else {
+              // Find next alternative
+              while (!ds.empty() &&
+                     (ds.top().alt+1U >= ds.top().c->alternatives())) {
+                Edge e = ds.pop();
+                delete e.s; delete e.c;
+              }
+              if (ds.empty())
+                break;
+              Edge& e = ds.top();
+              e.alt++;
+              if (e.alt+1U == e.c->alternatives()) {
+                // Last alternative: reuse space
+                cur = e.s; e.s = NULL;
+              } else {
+                cur = e.s->clone(t);
+              }
+              cur->commit(*e.c,e.alt);
+              cur_v = e.v;
+            }
+          }
+          out.add(static_cast<unsigned int>(M_DONE));
+          putstat(out,t);
+          (void) out.send(fd,true);
+        }
+        break;
+      default:
+        GECODE_NEVER;
+      }
+    }
+  }
+
+  void
+  Engine::receive(unsigned int i) {
+    unsigned int m;
+    if (!get(p[i].fd, &m, 1))
+      throw ProcessFailure("Search::Dist::Engine::receive");
+    switch (m) {
+    case M_SOLUTION:
+      {
+        Path sp;
+        (void) sp.read(p[i].fd);
+        // The worker waits until asked to continue
+        if (!best)
+          p[i].paused = true;
+        Space* s = sp.replay(*root);
+        if (best && (b != NULL))
+          s->constrain(*b);
+        if (s->status(stat) != SS_SOLVED) {
+          // Not better than the best solution found meanwhile
+          delete s;
+          break;
+        }
+        solution(s);
+        // Announce new bound to all other workers
+        if (best)
+          for (unsigned int j=0U; j<n_p; j++)
+            if (j != i) {
+              p[j].out.add(static_cast<unsigned int>(M_BOUND));
+              sp.write(p[j].out);
+            }
+      }
+      break;
+    case M_STATISTICS:
+      stat += getstat(p[i].fd);
+      break;
+    case M_DONE:
+      stat += getstat(p[i].fd);
+      p[i].busy = false;
+      break;
+    default:
+      GECODE_NEVER;
+    }
+  }
+
+  Space*
+  Engine::next(void) {
+    _stopped = false;
+    Region r;
+    struct pollfd* pfd = r.alloc<struct pollfd>(n_p);
+    while (solutions.empty()) {
+      bool busy = false;
+      for (unsigned int i=0U; i<n_p; i++) {
+        // Let workers continue that wait after a solution
+        if (p[i].paused) {
+          p[i].out.add(static_cast<unsigned int>(M_CONTINUE));
+          p[i].paused = false;
+        }
+        // Hand out open nodes to idle workers
+        if (!p[i].busy && !open.empty()) {
+          Path* w = open.pop();
+          p[i].out.add(static_cast<unsigned int>(M_WORK));
+          w->write(p[i].out);
+          delete w;
+          p[i].busy = true;
+        }
+        busy |= p[i].busy;
+      }
+      if (!busy)
+        return NULL;
+      if ((opt.stop != NULL) && opt.stop->stop(stat,opt)) {
+        _stopped = true;
+        return NULL;
+      }
+      /*
+       * Send without blocking: a worker might itself block while
+       * sending a solution and hence not read its messages. Messages
+       * that cannot be sent now are sent when the socket is writable.
+       */
+      for (unsigned int i=0U; i<n_p; i++) {
+        pfd[i].fd = p[i].fd; pfd[i].events = POLLIN; pfd[i].revents = 0;
+        if (!p[i].out.send(p[i].fd,false))
+          pfd[i].events |= POLLOUT;
+      }
+      // Wait for messages (with timeout to check the stop object)
+      if (::poll(pfd, n_p, 100) < 0) {
+        if (errno == EINTR)
+          continue;
+        throw ProcessFailure("Search::Dist::Engine::next");
+      }
+      for (unsigned int i=0U; i<n_p; i++)
+        if (pfd[i].revents & (POLLIN | POLLHUP | POLLERR))
+          receive(i);
+    }
+    return solutions.pop();
+  }
+
+  Statistics
+  Engine::statistics(void) const {
+    return stat;
+  }
+
+  bool
+  Engine::stopped(void) const {
+    return _stopped;
+  }
+
+  Engine::~Engine(void) {
+    for (unsigned int i=0U; i<n_p; i++) {
+      // Closing the socket terminates the worker anyway
+      try {
+        p[i].out.add(static_cast<unsigned int>(M_STOP));
+        (void) p[i].out.send(p[i].fd,false);
+      } catch (...) {}
+      ::close(p[i].fd);
+      int status;
+      (void) ::waitpid(static_cast<pid_t>(p[i].pid), &status, 0);
+    }
+    heap.free<Process>(p,n_p);
+    while (!open.empty())
+      delete open.pop();
+    while (!solutions.empty())
+      delete solutions.pop();
+    delete b;
+    delete root;
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-par
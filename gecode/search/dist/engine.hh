@@ -0,0 +1,204 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_DIST_ENGINE_HH__
+#define __GECODE_SEARCH_DIST_ENGINE_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+
+namespace Gecode { namespace Search { namespace Dist {
+
+  /**
+   * \brief Buffer for words to be sent to a different process
+   *
+   * Words are first added to the buffer and then sent. When sending
+   * without blocking, the words that could not be sent yet remain in
+   * the buffer.
+   */
+  class Buffer {
+  protected:
+    /// The words
+    unsigned int* w;
+    /// Number of words
+    unsigned int n;
+    /// Maximal number of words
+    unsigned int l;
+    /// Number of bytes already sent
+    size_t s;
+  public:
+    /// Initialize as empty buffer
+    Buffer(void);
+    /// Add word \a x
+    void add(unsigned int x);
+    /// Add \a x as two words
+    void add(unsigned long int x);
+    /// Test whether all words have been sent
+    bool empty(void) const;
+    /**
+     * \brief Send words to socket \a fd
+     *
+     * Returns false if not all words could be sent without blocking
+     * (only if \a block is false). Throws an exception of type
+     * ProcessFailure if the other process has terminated.
+     */
+    bool send(int fd, bool block);
+    /// Delete buffer
+    ~Buffer(void);
+  private:
+    /// A buffer cannot be copied
+    Buffer(const Buffer&);
+    /// A buffer cannot be assigned
+    Buffer& operator =(const Buffer&);
+  };
+
+  /**
+   * \brief Path from the root of the search tree to a node
+   *
+   * The path stores for each edge the archived choice together with
+   * the alternative taken. Hence, a path can be sent to a different
+   * process holding the same root space where it is replayed.
+   */
+  class Path {
+  protected:
+    /// Number of edges
+    unsigned int n;
+    /// Alternatives and archived choices of all edges
+    Archive a;
+  public:
+    /// Initialize as empty path (for the root)
+    Path(void);
+    /// Return number of edges
+    unsigned int edges(void) const;
+    /// Add edge for choice \a c and alternative \a alt
+    void push(const Choice& c, unsigned int alt);
+    /// Add edge for archived choice \a c and alternative \a alt
+    void push(const Archive& c, unsigned int alt);
+    /// Return space for the node (not yet propagated) by replaying from \a root
+    Space* replay(const Space& root) const;
+    /// Add path to buffer \a b
+    void write(Buffer& b) const;
+    /// Read path from socket \a fd, return false if closed
+    bool read(int fd);
+  };
+
+  /// Messages exchanged between engine and worker processes
+  enum Message {
+    M_WORK,       ///< Explore subtree (engine to worker)
+    M_BOUND,      ///< New best solution (engine to worker)
+    M_STOP,       ///< Terminate (engine to worker)
+    M_CONTINUE,   ///< Continue after solution (engine to worker, DFS only)
+    M_SOLUTION,   ///< Solution found (worker to engine)
+    M_STATISTICS, ///< Statistics while exploring (worker to engine)
+    M_DONE        ///< Subtree explored, with statistics (worker to engine)
+  };
+
+  /**
+   * \brief %Search engine distributing subtrees to worker processes
+   *
+   * The engine first explores the top of the search tree breadth-first
+   * until there are sufficiently many open nodes. Then it forks the
+   * worker processes, each of which inherits the root space. Open
+   * nodes, solutions, and (for best solution search) the incumbent
+   * solution are exchanged as paths through sockets.
+   *
+   * The engine never blocks when sending to a worker: messages that
+   * cannot be sent immediately are buffered and sent while waiting
+   * for messages from the workers. For %DFS, a worker waits after
+   * each solution until the engine is asked for a further solution.
+   *
+   * As only the thread calling \c fork is duplicated, the workers
+   * can only be created if the process runs no threads other than
+   * idle threads of the Gecode thread pool. Otherwise an exception
+   * of type ProcessFailure is thrown.
+   */
+  class Engine : public Search::Engine {
+  protected:
+    /// Information about a worker process
+    class Process {
+    public:
+      /// Process identifier
+      int pid;
+      /// Socket for communication with worker
+      int fd;
+      /// Messages not yet sent to worker
+      Buffer out;
+      /// Whether the worker explores a subtree
+      bool busy;
+      /// Whether the worker waits after a solution (DFS only)
+      bool paused;
+    };
+    /// Search options
+    Options opt;
+    /// Whether engine does best solution search
+    bool best;
+    /// Root space (propagated), NULL if failed
+    Space* root;
+    /// Best solution so far (for best solution search)
+    Space* b;
+    /// Open nodes not yet handed to a worker
+    Support::DynamicQueue<Path*,Heap> open;
+    /// Solutions not yet reported
+    Support::DynamicQueue<Space*,Heap> solutions;
+    /// Worker processes
+    Process* p;
+    /// Number of worker processes
+    unsigned int n_p;
+    /// Statistics
+    Statistics stat;
+    /// Whether engine has been stopped
+    bool _stopped;
+    /// Explore top of the search tree to create open nodes
+    void split(void);
+    /// Accept solution \a s (must be propagated)
+    void solution(Space* s);
+    /// Fork the worker processes
+    void fork(void);
+    /// Handle message from worker process \a i
+    void receive(unsigned int i);
+    /// Read bound from \a fd and make it the best solution \a w_b with version \a w_v if better
+    void bound(int fd, Space*& w_b, unsigned int& w_v);
+    /// Run worker process communicating through socket \a fd
+    void work(int fd);
+  public:
+    /// Initialize for space \a s with options \a o for \a best solution search
+    Engine(Space* s, const Options& o, bool best);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Terminate worker processes and delete
+    virtual ~Engine(void);
+  };
+
+}}}
+
+#endif
+
+// STATISTICS: search-par
@@ -48,6 +48,9 @@ namespace Gecode { namespace Search {
   NoBest::NoBest(const char* l)
     : Exception(l,"Best solution search is not supported") {}
 
+  ProcessFailure::ProcessFailure(const char* l)
+    : Exception(l,"Worker process for distributed search failed") {}
+
 }}
 
 // STATISTICS: search-other
@@ -62,6 +62,12 @@ namespace Gecode { namespace Search {
     /// Initialize with location \a l
     NoBest(const char* l);
   };
+  /// %Exception: Worker process for distributed search failed
+  class GECODE_SEARCH_EXPORT ProcessFailure : public Exception {
+  public:
+    /// Initialize with location \a l
+    ProcessFailure(const char* l);
+  };
   //@}
 }}
 
@@ -0,0 +1,172 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/exchange.hh>
+
+namespace Gecode { namespace Search {
+
+  /*
+   * Exchange of no-goods
+   *
+   */
+  Exchange::Exchange(unsigned int l0, unsigned int r0)
+    : n_assets(0U), n(0UL), bid(0U), l(l0), r(std::max(r0,1U)) {}
+
+  unsigned int
+  Exchange::limit(void) const {
+    return l;
+  }
+
+  unsigned int
+  Exchange::restarts(void) const {
+    return r;
+  }
+
+  void
+  Exchange::branchers(Space& home) {
+    unsigned int b = 0U;
+    for (Branchers bs(home,BrancherGroup::all); bs(); ++bs)
+      b = std::max(b,bs.brancher().id()+1U);
+    Support::Lock guard(m);
+    bid = b;
+  }
+
+  unsigned int
+  Exchange::subscribe(void) {
+    Support::Lock guard(m);
+    return n_assets++;
+  }
+
+  void
+  Exchange::publish(unsigned int a, const Archive& e) {
+    // Nothing to publish if there are no shared branchers or no edges
+    if ((e.size() == 0) || (e[0] == 0U))
+      return;
+    Support::Lock guard(m);
+    if (bid == 0U)
+      return;
+    Entry& en = entries[n % n_entries];
+    en.asset = a; en.path = e;
+    n++;
+  }
+
+  unsigned long int
+  Exchange::post(Space& home, unsigned int a, unsigned long int& i) {
+    Region reg;
+    Archive* es;
+    int n_es = 0;
+    unsigned int b;
+    {
+      Support::Lock guard(m);
+      b = bid;
+      // Entries that have been overwritten meanwhile are lost
+      if (n > n_entries)
+        i = std::max(i,n - n_entries);
+      es = reg.alloc<Archive>(n_entries);
+      for ( ; i < n; i++)
+        if (entries[i % n_entries].asset != a)
+          es[n_es++] = entries[i % n_entries].path;
+    }
+    unsigned long int n_ng = 0UL;
+    for (int j=0; (j<n_es) && !home.failed(); j++) {
+      ArchivedPath p;
+      p.unarchive(home,es[j],b);
+      p.post(home);
+      n_ng += p.ng();
+    }
+    reg.free<Archive>(es,n_entries);
+    return n_ng;
+  }
+
+  Exchange::~Exchange(void) {}
+
+
+  /*
+   * Archived paths
+   *
+   */
+  void
+  ArchivedPath::unarchive(const Space& home, Archive& e, unsigned int bid) {
+    unsigned int n; e >> n;
+    for (unsigned int i=0U; i<n; i++) {
+      unsigned int a, r, s;
+      e >> a >> r >> s;
+      Archive c;
+      for (unsigned int j=0U; j<s; j++) {
+        unsigned int w; e >> w; c << w;
+      }
+      // Only choices of shared branchers can be used
+      if ((s == 0U) || (c[0] >= bid))
+        return;
+      const Choice* ch;
+      try {
+        ch = home.choice(c);
+      } catch (SpaceNoBrancher&) {
+        return;
+      }
+      if (a >= ch->alternatives()) {
+        delete ch;
+        return;
+      }
+      ds.push(Edge(ch,a,r != 0U));
+    }
+  }
+
+  void
+  ArchivedPath::post(Space& home) const {
+    GECODE_ES_FAIL(NoGoodsProp::post(home,*this));
+  }
+
+  ArchivedPath::~ArchivedPath(void) {
+    while (!ds.empty())
+      delete ds.pop().choice();
+  }
+
+
+  /*
+   * Exchanged no-goods
+   *
+   */
+  void
+  ExchangeNoGoods::post(Space& home) const {
+    own.post(home);
+    unsigned long int n = own.ng();
+    if ((x != NULL) && !home.failed()) {
+      if (const ArchivableNoGoods* p =
+          dynamic_cast<const ArchivableNoGoods*>(&own)) {
+        Archive e;
+        p->archive(e,x->limit());
+        x->publish(a,e);
+      }
+      n += x->post(home,a,i);
+    }
+    const_cast<ExchangeNoGoods*>(this)->ng(n);
+  }
+
+}}
+
+// STATISTICS: search-other
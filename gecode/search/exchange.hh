@@ -0,0 +1,127 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_EXCHANGE_HH__
+#define __GECODE_SEARCH_EXCHANGE_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/nogoods.hh>
+
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Path reconstructed from archived choices for posting no-goods
+   *
+   * The archive of a path contains for each edge the true number of
+   * its alternative, whether the alternative is rightmost, and the
+   * archived choice. A path can be archived in one space and be
+   * unarchived in a different space that has compatible branchers.
+   */
+  class ArchivedPath : public NoGoods {
+    friend class NoGoodsProp;
+  public:
+    /// Edge of path
+    class Edge {
+    protected:
+      /// Choice (owned by the path)
+      const Choice* _choice;
+      /// True number of alternative
+      unsigned int _truealt;
+      /// Whether the alternative is rightmost
+      bool _rightmost;
+    public:
+      /// Default constructor
+      Edge(void);
+      /// Initialize with choice \a c, alternative \a a, and whether rightmost \a r
+      Edge(const Choice* c, unsigned int a, bool r);
+      /// Return choice
+      const Choice* choice(void) const;
+      /// Return true number of alternative
+      unsigned int truealt(void) const;
+      /// Test whether alternative is rightmost
+      bool rightmost(void) const;
+    };
+  protected:
+    /// Edges
+    Support::DynamicStack<Edge,Heap> ds;
+  public:
+    /// Initialize as empty path
+    ArchivedPath(void);
+    /// Return no-good depth limit
+    unsigned int ngdl(void) const;
+    /**
+     * \brief Read path from \a e for \a home
+     *
+     * Only the edges up to the first edge with a choice of a brancher
+     * with identity of at least \a bid or a brancher that does not
+     * exist in \a home are read.
+     */
+    GECODE_SEARCH_EXPORT void unarchive(const Space& home, Archive& e,
+                                        unsigned int bid);
+    /// Archive at most \a l edges of path \a p (with no-goods) into \a e
+    template<class Path>
+    static void archive(const Path& p, Archive& e, unsigned int l);
+    /// Post no-goods to \a home
+    GECODE_SEARCH_EXPORT virtual void post(Space& home) const;
+    /// Delete path
+    GECODE_SEARCH_EXPORT virtual ~ArchivedPath(void);
+  };
+
+  /**
+   * \brief No-goods of an asset combined with exchanged no-goods
+   *
+   * When posted, the no-goods of the asset are posted. If exchange is
+   * enabled, the no-goods of the asset are also published and the
+   * no-goods of other assets are posted. As posting is done by the
+   * master function of the space, no-goods are only exchanged by assets
+   * that also post their own no-goods.
+   */
+  class ExchangeNoGoods : public NoGoods {
+  protected:
+    /// No-goods of the asset
+    NoGoods& own;
+    /// Exchange channel (NULL if no exchange)
+    Exchange* x;
+    /// Number of asset
+    unsigned int a;
+    /// Number of first entry not yet considered by asset
+    unsigned long int& i;
+  public:
+    /// Initialize
+    ExchangeNoGoods(NoGoods& own, Exchange* x, unsigned int a,
+                    unsigned long int& i);
+    /// Post no-goods
+    GECODE_SEARCH_EXPORT virtual void post(Space& home) const;
+  };
+
+}}
+
+#include <gecode/search/exchange.hpp>
+
+#endif
+
+// STATISTICS: search-other
@@ -0,0 +1,100 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Search {
+
+  /*
+   * Edges of archived paths
+   *
+   */
+  forceinline
+  ArchivedPath::Edge::Edge(void) {}
+
+  forceinline
+  ArchivedPath::Edge::Edge(const Choice* c, unsigned int a, bool r)
+    : _choice(c), _truealt(a), _rightmost(r) {}
+
+  forceinline const Choice*
+  ArchivedPath::Edge::choice(void) const {
+    return _choice;
+  }
+
+  forceinline unsigned int
+  ArchivedPath::Edge::truealt(void) const {
+    return _truealt;
+  }
+
+  forceinline bool
+  ArchivedPath::Edge::rightmost(void) const {
+    return _rightmost;
+  }
+
+
+  /*
+   * Archived paths
+   *
+   */
+  forceinline
+  ArchivedPath::ArchivedPath(void) : ds(heap) {}
+
+  forceinline unsigned int
+  ArchivedPath::ngdl(void) const {
+    return static_cast<unsigned int>(ds.entries());
+  }
+
+  template<class Path>
+  forceinline void
+  ArchivedPath::archive(const Path& p, Archive& e, unsigned int l) {
+    int n = std::min(p.ds.entries(),
+                     static_cast<int>(std::min(p.ngdl(),l)));
+    // Edges at the end without alternatives explored yield no no-goods
+    while ((n > 0) && (p.ds[n-1].truealt() == 0U))
+      n--;
+    e << n;
+    for (int i=0; i<n; i++) {
+      Archive c;
+      p.ds[i].choice()->archive(c);
+      e << p.ds[i].truealt() << (p.ds[i].rightmost() ? 1U : 0U)
+        << c.size();
+      for (int j=0; j<c.size(); j++)
+        e << c[j];
+    }
+  }
+
+
+  /*
+   * Exchanged no-goods
+   *
+   */
+  forceinline
+  ExchangeNoGoods::ExchangeNoGoods(NoGoods& own0, Exchange* x0,
+                                   unsigned int a0, unsigned long int& i0)
+    : own(own0), x(x0), a(a0), i(i0) {}
+
+}}
+
+// STATISTICS: search-other
@@ -61,6 +61,13 @@ namespace Gecode { namespace Search {
     virtual NGL* copy(Space& home);
   };
 
+  /// No-goods that can be archived for exchange between engines
+  class GECODE_VTABLE_EXPORT ArchivableNoGoods : public NoGoods {
+  public:
+    /// Archive at most \a l edges of the path for no-goods into \a e
+    virtual void archive(Archive& e, unsigned int l) const = 0;
+  };
+
   /// No-good propagator
   class GECODE_SEARCH_EXPORT NoGoodsProp : public Propagator {
   protected:
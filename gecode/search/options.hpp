@@ -36,11 +36,13 @@ namespace Gecode { namespace Search {
   forceinline
   Options::Options(void)
     : clone(Config::clone),
-      threads(Config::threads),
+      threads(Config::threads), processes(0),
       c_d(Config::c_d), a_d(Config::a_d),
       d_l(Config::d_l),
       assets(0), slice(Config::slice), nogoods_limit(0),
-      stop(nullptr), cutoff(nullptr), tracer(nullptr) {}
+      work_stealing(false), numa(false),
+      stop(nullptr), cutoff(nullptr), tracer(nullptr),
+      exchange(nullptr) {}
 
 }}
 
@@ -76,10 +76,19 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
+      using Engine<Tracer>::Worker::rnd;
+      using Engine<Tracer>::Worker::numa;
+      using Engine<Tracer>::Worker::chunks;
       /// Number of entries not yet constrained to be better
       int mark;
       /// Best solution found so far
       Space* best;
+      /// Whether the current space is propagated without holding the mutex
+      bool propagating;
+      /// Whether the current space must still be constrained by \a best
+      bool pending;
+      /// Propagate \a cur, allow stealing meanwhile for work stealing
+      SpaceStatus status(void);
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, BAB& e);
@@ -57,6 +57,8 @@ namespace Gecode { namespace Search { namespace Par {
     path.reset((s == NULL) ? 0 : ngdl);
     d = 0;
     mark = 0;
+    propagating = false;
+    pending = false;
     idle = false;
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
       delete s;
@@ -74,7 +76,8 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline
   BAB<Tracer>::Worker::Worker(Space* s, BAB& e)
-    : Engine<Tracer>::Worker(s,e), mark(0), best(NULL) {}
+    : Engine<Tracer>::Worker(s,e), mark(0), best(NULL),
+      propagating(false), pending(false) {}
 
   template<class Tracer>
   forceinline
@@ -108,8 +111,13 @@ namespace Gecode { namespace Search { namespace Par {
     delete best;
     best = b->clone();
     mark = path.entries();
-    if (cur != NULL)
-      cur->constrain(*best);
+    if (cur != NULL) {
+      // The current space must not be touched while being propagated
+      if (propagating)
+        pending = true;
+      else
+        cur->constrain(*best);
+    }
     m.release();
   }
   template<class Tracer>
@@ -146,11 +154,41 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline void
   BAB<Tracer>::Worker::find(void) {
+    unsigned int n = engine().workers();
+    // With work stealing, start with a random victim
+    unsigned int o = engine().opt().work_stealing ? rnd(n) : 0U;
     // Try to find new work (even if there is none)
-    for (unsigned int i=0U; i<engine().workers(); i++) {
+    for (unsigned int i=0U; i<n; i++) {
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
-      if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
+      typename Engine<Tracer>::Worker* wi = engine().worker((o+i) % n);
+      if (engine().opt().work_stealing && !tracer) {
+        Archive a;
+        unsigned int l, u, nid;
+        if (Space* s = wi->steal(r_d,a,l,u,nid)) {
+          // Reset this guy
+          m.acquire();
+          idle = false;
+          // Not idle but also does not have the root of the tree
+          path.ngdl(0);
+          d = 0;
+          cur = NULL;
+          mark = 0;
+          if (best != NULL)
+            s->constrain(*best);
+          Statistics t = *this;
+          Search::Worker::reset(r_d);
+          (*this) += t;
+          // The stolen alternatives are explored by recomputation
+          if (s->status(*this) == SS_FAILED) {
+            fail++;
+            delete s;
+          } else {
+            path.push(*this,s,s->choice(a),l,u,nid);
+          }
+          m.release();
+          return;
+        }
+      } else if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
         // Reset this guy
         m.acquire();
         idle = false;
@@ -170,6 +208,21 @@ namespace Gecode { namespace Search { namespace Par {
     }
   }
 
+  /*
+   * Worker: propagation
+   */
+  template<class Tracer>
+  forceinline SpaceStatus
+  BAB<Tracer>::Worker::status(void) {
+    propagating = true;
+    SpaceStatus ss = Engine<Tracer>::Worker::status();
+    propagating = false;
+    // Only a space to be explored further must be constrained
+    if (ss != SS_BRANCH)
+      pending = false;
+    return ss;
+  }
+
   /*
    * Statistics
    */
@@ -223,6 +276,11 @@ namespace Gecode { namespace Search { namespace Par {
      *   betterness is guaranteed.
      *
      */
+    // Bind thread to a NUMA node
+    if (engine().opt().numa)
+      for (unsigned int i=0U; i<engine().workers(); i++)
+        if (this == engine().worker(i))
+          numa(i);
     // Peform initial delay, if not first worker
     if (this != engine().worker(0))
       Support::Thread::sleep(Config::initial_delay);
@@ -238,6 +296,11 @@ namespace Gecode { namespace Search { namespace Par {
         engine().ack_terminate();
         // Wait until termination can proceed
         engine().wait_terminate();
+        // Threads are reused, so do not leave them bound
+        if (engine().opt().numa) {
+          Kernel::SharedMemory::numa(false);
+          Support::Thread::unpin();
+        }
         // Thread will be terminated by returning from run
         return;
       case C_RESET:
@@ -252,6 +315,8 @@ namespace Gecode { namespace Search { namespace Par {
         // Perform exploration work
         {
           m.acquire();
+          // Account for memory released since the last exploration step
+          chunks();
           if (idle) {
             m.release();
             // Try to find new work
@@ -276,7 +341,7 @@ namespace Gecode { namespace Search { namespace Par {
                 }
               }
               unsigned int nid = tracer.nid();
-              switch (cur->status(*this)) {
+              switch (status()) {
               case SS_FAILED:
                 if (tracer) {
                   SearchTracer::NodeInfo ni(SearchTracer::NodeType::FAILED,
@@ -310,7 +375,7 @@ namespace Gecode { namespace Search { namespace Par {
                 {
                   Space* c;
                   if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                    c = cur->clone(*this);
                     d = 1;
                   } else {
                     c = NULL;
@@ -323,6 +388,12 @@ namespace Gecode { namespace Search { namespace Par {
                     tracer.node(ei,ni);
                   }
                   cur->commit(*ch,0);
+                  // Better solution found during propagation
+                  if (pending) {
+                    pending = false;
+                    mark = path.entries();
+                    cur->constrain(*best);
+                  }
                   m.release();
                 }
                 break;
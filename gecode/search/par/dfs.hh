@@ -76,6 +76,10 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
+      using Engine<Tracer>::Worker::rnd;
+      using Engine<Tracer>::Worker::numa;
+      using Engine<Tracer>::Worker::chunks;
+      using Engine<Tracer>::Worker::status;
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, DFS& e);
       /// Provide access to engine
@@ -120,11 +120,38 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline void
   DFS<Tracer>::Worker::find(void) {
+    unsigned int n = engine().workers();
+    // With work stealing, start with a random victim
+    unsigned int o = engine().opt().work_stealing ? rnd(n) : 0U;
     // Try to find new work (even if there is none)
-    for (unsigned int i=0U; i<engine().workers(); i++) {
+    for (unsigned int i=0U; i<n; i++) {
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
-      if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
+      typename Engine<Tracer>::Worker* wi = engine().worker((o+i) % n);
+      if (engine().opt().work_stealing && !tracer) {
+        Archive a;
+        unsigned int l, u, nid;
+        if (Space* s = wi->steal(r_d,a,l,u,nid)) {
+          // Reset this guy
+          m.acquire();
+          idle = false;
+          // Not idle but also does not have the root of the tree
+          path.ngdl(0);
+          d = 0;
+          cur = NULL;
+          Statistics t = *this;
+          Search::Worker::reset(r_d);
+          (*this) += t;
+          // The stolen alternatives are explored by recomputation
+          if (s->status(*this) == SS_FAILED) {
+            fail++;
+            delete s;
+          } else {
+            path.push(*this,s,s->choice(a),l,u,nid);
+          }
+          m.release();
+          return;
+        }
+      } else if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
         // Reset this guy
         m.acquire();
         idle = false;
@@ -171,6 +198,11 @@ namespace Gecode { namespace Search { namespace Par {
      * when the engine is stopped or has found a solution.
      *
      */
+    // Bind thread to a NUMA node
+    if (engine().opt().numa)
+      for (unsigned int i=0U; i<engine().workers(); i++)
+        if (this == engine().worker(i))
+          numa(i);
     // Peform initial delay, if not first worker
     if (this != engine().worker(0))
       Support::Thread::sleep(Config::initial_delay);
@@ -186,6 +218,11 @@ namespace Gecode { namespace Search { namespace Par {
         engine().ack_terminate();
         // Wait until termination can proceed
         engine().wait_terminate();
+        // Threads are reused, so do not leave them bound
+        if (engine().opt().numa) {
+          Kernel::SharedMemory::numa(false);
+          Support::Thread::unpin();
+        }
         // Thread will be terminated by returning from run
         return;
       case C_RESET:
@@ -200,6 +237,8 @@ namespace Gecode { namespace Search { namespace Par {
         // Perform exploration work
         {
           m.acquire();
+          // Account for memory released since the last exploration step
+          chunks();
           if (idle) {
             m.release();
             // Try to find new work
@@ -224,7 +263,7 @@ namespace Gecode { namespace Search { namespace Par {
                 }
               }
               unsigned int nid = tracer.nid();
-              switch (cur->status(*this)) {
+              switch (status()) {
               case SS_FAILED:
                 if (tracer) {
                   SearchTracer::NodeInfo ni(SearchTracer::NodeType::FAILED,
@@ -258,7 +297,7 @@ namespace Gecode { namespace Search { namespace Par {
                 {
                   Space* c;
                   if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                    c = cur->clone(*this);
                     d = 1;
                   } else {
                     c = NULL;
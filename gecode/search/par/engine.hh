@@ -63,11 +63,32 @@ namespace Gecode { namespace Search { namespace Par {
       unsigned int d;
       /// Whether the worker is idle
       bool idle;
+      /// Random number generator for selecting victims
+      Support::RandomGenerator rnd;
+      /// Number of heap chunks reused by the thread when last accounted
+      unsigned long int numa_l;
+      /// Number of heap chunks released remotely by the thread when last accounted
+      unsigned long int numa_r;
+      /// Bind thread of \a i-th worker to NUMA node and start accounting for memory reuse
+      void numa(unsigned int i);
+      /// Account for memory reused by the thread since last accounted (in NUMA mode)
+      void chunks(void);
+      /// Propagate \a cur (allow stealing meanwhile for work stealing)
+      SpaceStatus status(void);
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, Engine& e);
       /// Hand over some work (NULL if no work available)
       Space* steal(unsigned long int& d, Tracer& myt, Tracer& ot);
+      /**
+       * \brief Hand over half of the open alternatives of a node
+       *
+       * Does not wait if the worker is busy and returns NULL instead
+       * (as well as if no work is available). See Path::steal for
+       * the meaning of the arguments.
+       */
+      Space* steal(unsigned long int& d, Archive& a,
+                   unsigned int& l, unsigned int& u, unsigned int& nid);
       /// Return statistics
       Statistics statistics(void);
       /// Provide access to engine
@@ -178,8 +199,8 @@ namespace Gecode { namespace Search { namespace Par {
   public:
     /// Report that worker is idle
     void idle(void);
-    /// Report that worker is busy
-    void busy(void);
+    /// Report that worker is busy, return false if no worker is busy
+    bool busy(void);
     /// Report that worker has been stopped
     void stop(void);
     //@}
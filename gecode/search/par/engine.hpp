@@ -95,7 +95,8 @@ namespace Gecode { namespace Search { namespace Par {
   Engine<Tracer>::Worker::Worker(Space* s, Engine& e)
     : tracer(e.opt().tracer), _engine(e),
       path(s == NULL ? 0 : e.opt().nogoods_limit), d(0),
-      idle(false) {
+      idle(false), rnd(e.opt().work_stealing ? Support::hwrnd() : 1U),
+      numa_l(0UL), numa_r(0UL) {
     tracer.worker();
     if (s != NULL) {
       if (s->status(*this) == SS_FAILED) {
@@ -159,12 +160,14 @@ namespace Gecode { namespace Search { namespace Par {
   }
 
   template<class Tracer>
-  forceinline void
+  forceinline bool
   Engine<Tracer>::busy(void) {
     m_search.acquire();
-    assert(n_busy > 0);
-    n_busy++;
+    bool b = (n_busy > 0);
+    if (b)
+      n_busy++;
     m_search.release();
+    return b;
   }
 
   template<class Tracer>
@@ -272,15 +275,90 @@ namespace Gecode { namespace Search { namespace Par {
      */
     if (!path.steal())
       return NULL;
+    /*
+     * Tell that there will be one more busy worker before stealing:
+     * otherwise the victim might run out of work and report being idle
+     * before. This must not be done while holding the mutex of the
+     * victim, as the engine acquires its mutex before the mutexes of
+     * the workers (for example, when constraining them in BAB).
+     */
+    if (!engine().busy())
+      return NULL;
     m.acquire();
     Space* s = path.steal(*this,d,myt,ot);
     m.release();
-    // Tell that there will be one more busy worker
-    if (s != NULL)
-      engine().busy();
+    // Undo if nothing could be stolen after all
+    if (s == NULL)
+      engine().idle();
+    return s;
+  }
+
+  template<class Tracer>
+  forceinline Space*
+  Engine<Tracer>::Worker::steal(unsigned long int& d, Archive& a,
+                                unsigned int& l, unsigned int& u,
+                                unsigned int& nid) {
+    // Tell that there will be one more busy worker (see above)
+    if (!path.steal() || !engine().busy())
+      return NULL;
+    // Do not wait for a busy worker
+    Space* s = NULL;
+    if (m.tryacquire()) {
+      s = path.steal(*this,d,a,l,u,nid);
+      m.release();
+    }
+    // Undo if nothing could be stolen after all
+    if (s == NULL)
+      engine().idle();
     return s;
   }
 
+  /*
+   * Worker: NUMA support
+   */
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::numa(unsigned int i) {
+    Support::Thread::pin(i % Support::Thread::nodes());
+    Kernel::SharedMemory::numa(true);
+    numa_l = Kernel::SharedMemory::local();
+    numa_r = Kernel::SharedMemory::remote();
+  }
+
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::chunks(void) {
+    if (engine().opt().numa) {
+      // The counters are per thread and the thread only works for this worker
+      unsigned long int l = Kernel::SharedMemory::local();
+      unsigned long int r = Kernel::SharedMemory::remote();
+      numa_local += l - numa_l; numa_l = l;
+      numa_remote += r - numa_r; numa_r = r;
+    }
+  }
+
+  /*
+   * Worker: propagation
+   */
+  template<class Tracer>
+  forceinline SpaceStatus
+  Engine<Tracer>::Worker::status(void) {
+    if (!engine().opt().work_stealing)
+      return cur->status(*this);
+    /*
+     * The path is not touched during propagation: release the mutex
+     * such that other workers can steal in the meantime. The statistics
+     * are only updated while holding the mutex, as thieves and the
+     * engine access them meanwhile.
+     */
+    m.release();
+    StatusStatistics t;
+    SpaceStatus ss = cur->status(t);
+    m.acquire();
+    propagate += t.propagate;
+    return ss;
+  }
+
   /*
    * Return No-Goods
    */
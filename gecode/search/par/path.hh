@@ -40,6 +40,7 @@
 #include <gecode/search/support.hh>
 #include <gecode/search/worker.hh>
 #include <gecode/search/nogoods.hh>
+#include <gecode/search/exchange.hh>
 
 namespace Gecode { namespace Search { namespace Par {
 
@@ -57,8 +58,9 @@ namespace Gecode { namespace Search { namespace Par {
    *
    */
   template<class Tracer>
-  class Path : public NoGoods {
+  class Path : public ArchivableNoGoods {
     friend class Search::NoGoodsProp;
+    friend class Search::ArchivedPath;
   public:
     /// Identity type
     typedef typename Tracer::ID ID;
@@ -80,6 +82,9 @@ namespace Gecode { namespace Search { namespace Par {
       Edge(void);
       /// Edge for space \a s with clone \a c (possibly NULL)
       Edge(Space* s, Space* c, unsigned int nid);
+      /// Edge for clone \a c with choice \a ch and alternatives \a l to \a u
+      Edge(Space* c, const Choice* ch,
+           unsigned int l, unsigned int u, unsigned int nid);
 
       /// Return space for edge
       Space* space(void) const;
@@ -103,6 +108,10 @@ namespace Gecode { namespace Search { namespace Par {
       void next(void);
       /// Steal rightmost alternative and return its number
       unsigned int steal(void);
+      /// Return number of alternatives that can be stolen
+      unsigned int open(void) const;
+      /// Steal \a n rightmost alternatives and return leftmost stolen one
+      unsigned int steal(unsigned int n);
 
       /// Return node identifier
       unsigned int nid(void) const;
@@ -126,6 +135,9 @@ namespace Gecode { namespace Search { namespace Par {
     void ngdl(unsigned int l);
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c, unsigned int nid);
+    /// Push clone \a c with choice \a ch and alternatives \a l to \a u
+    void push(Worker& stat, Space* c, const Choice* ch,
+              unsigned int l, unsigned int u, unsigned int nid);
     /// Generate path for next node
     void next(void);
     /// Provide access to topmost edge
@@ -154,8 +166,19 @@ namespace Gecode { namespace Search { namespace Par {
     /// Steal work at depth \a d
     Space* steal(Worker& stat, unsigned long int& d,
                  Tracer& myt, Tracer& ot);
+    /**
+     * \brief Steal half of the open alternatives at the shallowest node
+     *
+     * Returns the (not yet propagated) space for the node at depth
+     * \a d, archives its choice into \a a, and sets \a l and \a u to
+     * the first and last alternative stolen.
+     */
+    Space* steal(Worker& stat, unsigned long int& d, Archive& a,
+                 unsigned int& l, unsigned int& u, unsigned int& nid);
     /// Post no-goods
     void virtual post(Space& home) const;
+    /// Archive at most \a l edges for no-goods into \a e
+    virtual void archive(Archive& e, unsigned int l) const;
   };
 
 }}}
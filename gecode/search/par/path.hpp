@@ -48,6 +48,14 @@ namespace Gecode { namespace Search { namespace Par {
     _alt_max = _choice->alternatives()-1;
   }
 
+  template<class Tracer>
+  forceinline
+  Path<Tracer>::Edge::Edge(Space* c, const Choice* ch,
+                           unsigned int l, unsigned int u, unsigned int nid)
+    : _space(c), _alt(l), _alt_max(u), _choice(ch), _nid(nid) {
+    assert((l <= u) && (u < _choice->alternatives()));
+  }
+
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::Edge::space(void) const {
@@ -102,6 +110,18 @@ namespace Gecode { namespace Search { namespace Par {
     assert(work());
     return _alt_max--;
   }
+  template<class Tracer>
+  forceinline unsigned int
+  Path<Tracer>::Edge::open(void) const {
+    return work() ? _alt_max - _alt : 0U;
+  }
+  template<class Tracer>
+  forceinline unsigned int
+  Path<Tracer>::Edge::steal(unsigned int n) {
+    assert((n > 0U) && (n <= open()));
+    _alt_max -= n;
+    return _alt_max+1U;
+  }
 
   template<class Tracer>
   forceinline const Choice*
@@ -155,6 +175,18 @@ namespace Gecode { namespace Search { namespace Par {
     return sn.choice();
   }
 
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::push(Worker& stat, Space* c, const Choice* ch,
+                     unsigned int l, unsigned int u, unsigned int nid) {
+    assert(ds.empty());
+    Edge sn(c,ch,l,u,nid);
+    if (sn.work())
+      n_work++;
+    ds.push(sn);
+    stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
+  }
+
   template<class Tracer>
   forceinline void
   Path<Tracer>::next(void) {
@@ -263,7 +295,7 @@ namespace Gecode { namespace Search { namespace Par {
         // Find last copy
         while (ds[l].space() == NULL)
           l--;
-        Space* c = ds[l].space()->clone();
+        Space* c = ds[l].space()->clone(stat);
         // Recompute, if necessary
         for (int i=l; i<n; i++)
           commit(c,i);
@@ -284,6 +316,37 @@ namespace Gecode { namespace Search { namespace Par {
     return NULL;
   }
 
+  template<class Tracer>
+  forceinline Space*
+  Path<Tracer>::steal(Worker& stat, unsigned long int& d, Archive& a,
+                      unsigned int& l, unsigned int& u, unsigned int& nid) {
+    if (n_work <= Config::steal_limit)
+      return NULL;
+    // Steal at the shallowest node with work: it has the largest subtrees
+    int n = 0;
+    while (!ds[n].work())
+      n++;
+    // Find last copy
+    int c_n = n;
+    while (ds[c_n].space() == NULL)
+      c_n--;
+    Space* c = ds[c_n].space()->clone(stat);
+    // Recompute up to the node itself, its choice is handed over
+    for (int i=c_n; i<n; i++)
+      commit(c,i);
+    ds[n].choice()->archive(a);
+    unsigned int k = (ds[n].open() + 1U) / 2U;
+    l = ds[n].steal(k);
+    u = l + k - 1U;
+    nid = ds[n].nid();
+    if (!ds[n].work())
+      n_work--;
+    // No no-goods can be extracted above n
+    ngdl(std::min(ngdl(),static_cast<unsigned int>(n)));
+    d = stat.steal_depth(static_cast<unsigned long int>(n));
+    return c;
+  }
+
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::recompute(unsigned int& d, unsigned int a_d, Worker& stat,
@@ -310,7 +373,7 @@ namespace Gecode { namespace Search { namespace Par {
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
@@ -340,7 +403,7 @@ namespace Gecode { namespace Search { namespace Par {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
@@ -397,10 +460,10 @@ namespace Gecode { namespace Search { namespace Par {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(stat);
       ds[l].space(c);
     } else {
-      s = s->clone();
+      s = s->clone(stat);
     }
 
     if (d < a_d) {
@@ -434,7 +497,7 @@ namespace Gecode { namespace Search { namespace Par {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
@@ -450,6 +513,12 @@ namespace Gecode { namespace Search { namespace Par {
     GECODE_ES_FAIL(NoGoodsProp::post(home,*this));
   }
 
+  template<class Tracer>
+  void
+  Path<Tracer>::archive(Archive& e, unsigned int l) const {
+    ArchivedPath::archive(*this,e,l);
+  }
+
 }}}
 
 // STATISTICS: search-par
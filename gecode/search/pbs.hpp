@@ -290,6 +290,11 @@ namespace Gecode {
     // Always execute master function
     (void) master->master(0);
 
+    // Only branchers of the master can be used for exchanging no-goods
+    for (int i=0; i<sebs.size(); i++)
+      if (Search::Exchange* x = sebs[i]->options().exchange)
+        x->branchers(*master);
+
 #ifdef GECODE_HAS_THREADS
     if (opt.threads > 1.0)
       e = Search::pbspar<T,E>(master,sebs,stat,opt,best);
@@ -127,7 +127,7 @@ namespace Gecode { namespace Search { namespace Seq {
         {
           Space* c;
           if ((d == 0) || (d >= opt.c_d)) {
-            c = cur->clone();
+            c = cur->clone(*this);
             d = 1;
           } else {
             c = NULL;
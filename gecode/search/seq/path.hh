@@ -40,6 +40,7 @@
 #include <gecode/search/support.hh>
 #include <gecode/search/worker.hh>
 #include <gecode/search/nogoods.hh>
+#include <gecode/search/exchange.hh>
 
 namespace Gecode { namespace Search { namespace Seq {
 
@@ -57,8 +58,9 @@ namespace Gecode { namespace Search { namespace Seq {
    *
    */
   template<class Tracer>
-  class GECODE_VTABLE_EXPORT Path : public NoGoods {
+  class GECODE_VTABLE_EXPORT Path : public ArchivableNoGoods {
     friend class Search::NoGoodsProp;
+    friend class Search::ArchivedPath;
   public:
     /// Node identity type
     typedef typename Tracer::ID ID;
@@ -145,6 +147,8 @@ namespace Gecode { namespace Search { namespace Seq {
     void reset(void);
     /// Post no-goods
     virtual void post(Space& home) const;
+    /// Archive at most \a l edges for no-goods into \a e
+    virtual void archive(Archive& e, unsigned int l) const;
   };
 
 }}}
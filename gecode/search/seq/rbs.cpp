@@ -60,9 +60,10 @@ namespace Gecode { namespace Search { namespace Seq {
       NoGoods& ng = e->nogoods();
       // Reset number of no-goods found
       ng.ng(0);
-      MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
+      ExchangeNoGoods xng(ng,exchange(),x_a,x_i);
+      MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,xng);
       bool r = master->master(mi);
-      stop->m_stat.nogood += ng.ng();
+      stop->m_stat.nogood += xng.ng();
       if (master->status(stop->m_stat) == SS_FAILED) {
         stop->update(e->statistics());
         delete master;
@@ -94,9 +95,10 @@ namespace Gecode { namespace Search { namespace Seq {
         sslr = 0;
         NoGoods& ng = e->nogoods();
         ng.ng(0);
-        MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
+        ExchangeNoGoods xng(ng,exchange(),x_a,x_i);
+        MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,xng);
         (void) master->master(mi);
-        stop->m_stat.nogood += ng.ng();
+        stop->m_stat.nogood += xng.ng();
         long unsigned int nl = ++(*co);
         stop->limit(e->statistics(),nl);
         if (master->status(stop->m_stat) == SS_FAILED)
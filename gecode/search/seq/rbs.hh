@@ -35,6 +35,7 @@
 #define __GECODE_SEARCH_SEQ_RBS_HH__
 
 #include <gecode/search.hh>
+#include <gecode/search/exchange.hh>
 
 namespace Gecode { namespace Search { namespace Seq {
 
@@ -91,6 +92,14 @@ namespace Gecode { namespace Search { namespace Seq {
     bool restart;
     /// Whether the engine performs best solution search
     bool best;
+    /// Exchange of no-goods with other assets (NULL if none)
+    Exchange* x;
+    /// Number of the engine as asset for exchange
+    unsigned int x_a;
+    /// Number of first exchanged entry not yet posted
+    unsigned long int x_i;
+    /// Return exchange if no-goods are exchanged at the current restart
+    Exchange* exchange(void) const;
   public:
     /// Constructor
     RBS(Space* s, RestartStop* stop0, Engine* e0,
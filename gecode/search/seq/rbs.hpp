@@ -67,10 +67,17 @@ namespace Gecode { namespace Search { namespace Seq {
            bool best0)
     : e(e0), master(s), last(NULL), co(opt.cutoff), stop(stop0),
       sslr(0),
-      complete(true), restart(false), best(best0) {
+      complete(true), restart(false), best(best0),
+      x(opt.exchange), x_a((x != NULL) ? x->subscribe() : 0U), x_i(0UL) {
     stop->limit(stat,(*co)());
   }
 
+  forceinline Exchange*
+  RBS::exchange(void) const {
+    return ((x != NULL) && (stop->m_stat.restart % x->restarts() == 0UL))
+      ? x : NULL;
+  }
+
 }}}
 
 // STATISTICS: search-seq
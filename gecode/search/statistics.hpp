@@ -38,22 +38,27 @@ namespace Gecode { namespace Search {
   forceinline void
   Statistics::reset(void) {
     StatusStatistics::reset();
+    CloneStatistics::reset();
     fail=0; node=0; depth=0; restart=0; nogood=0;
+    numa_local=0; numa_remote=0;
   }
 
   forceinline
   Statistics::Statistics(void)
     : fail(0), node(0), depth(0),
-      restart(0), nogood(0) {}
+      restart(0), nogood(0), numa_local(0), numa_remote(0) {}
 
   forceinline Statistics&
   Statistics::operator +=(const Statistics& s) {
     (void) StatusStatistics::operator +=(s);
+    (void) CloneStatistics::operator +=(s);
     fail += s.fail;
     node += s.node;
     depth = std::max(depth,s.depth);
     restart += s.restart;
     nogood += s.nogood;
+    numa_local += s.numa_local;
+    numa_remote += s.numa_remote;
     return *this;
   }
 
@@ -143,6 +143,7 @@
 
 #include <gecode/support/timer.hpp>
 #include <gecode/support/hw-rnd.hpp>
+#include <gecode/support/simd.hpp>
 
 /*
  * Miscellaneous
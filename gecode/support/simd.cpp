@@ -0,0 +1,74 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/support.hh>
+
+#include <atomic>
+
+namespace Gecode { namespace Support {
+
+  namespace {
+
+    /// Return best instruction set extension supported by the processor
+    SIMD detect(void) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f"))
+        return SIMD_AVX512;
+      if (__builtin_cpu_supports("avx2"))
+        return SIMD_AVX2;
+#endif
+      return SIMD_NONE;
+    }
+
+    /// Best instruction set extension permitted (negative if not restricted)
+    std::atomic<int> permitted(-1);
+
+  }
+
+  SIMD
+  simd(void) {
+    static const SIMD available = detect();
+    int p = permitted.load(std::memory_order_relaxed);
+    /*
+     * Gathering four words with AVX2 is not faster than scalar code,
+     * hence AVX2 is only used if requested explicitly.
+     */
+    if (p < 0)
+      return (available == SIMD_AVX512) ? SIMD_AVX512 : SIMD_NONE;
+    return static_cast<SIMD>(std::min(p,static_cast<int>(available)));
+  }
+
+  void
+  simd(SIMD s) {
+    permitted.store(s,std::memory_order_relaxed);
+  }
+
+}}
+
+// STATISTICS: support-any
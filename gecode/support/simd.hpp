@@ -0,0 +1,59 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Support {
+
+  /**
+   * \brief Instruction set extensions for vectorized operations
+   * \ingroup FuncSupport
+   */
+  enum SIMD {
+    SIMD_NONE,   ///< Only scalar instructions
+    SIMD_AVX2,   ///< AVX2 instructions
+    SIMD_AVX512  ///< AVX-512 foundation instructions
+  };
+
+  /**
+   * \brief Return best instruction set extension to be used
+   *
+   * The result is the best extension supported by the processor,
+   * restricted by the last call to simd(SIMD). Unless simd(SIMD) has
+   * been called, AVX2 instructions are not used.
+   * \ingroup FuncSupport
+   */
+  GECODE_SUPPORT_EXPORT SIMD simd(void);
+
+  /**
+   * \brief Restrict instruction set extensions used to at most \a s
+   * \ingroup FuncSupport
+   */
+  GECODE_SUPPORT_EXPORT void simd(SIMD s);
+
+}}
+
+// STATISTICS: support-any
@@ -336,6 +336,16 @@ namespace Gecode { namespace Support {
     static void sleep(unsigned int ms);
     /// Return number of processing units (1 if information not available)
     static unsigned int npu(void);
+    /// Return number of idle threads in the pool
+    GECODE_SUPPORT_EXPORT static unsigned int pooled(void);
+    /// Return number of NUMA nodes (1 if information not available)
+    GECODE_SUPPORT_EXPORT static unsigned int nodes(void);
+    /// Return NUMA node the current thread runs on (0 if information not available)
+    GECODE_SUPPORT_EXPORT static unsigned int node(void);
+    /// Bind current thread to the processing units of the \a n-th NUMA node
+    GECODE_SUPPORT_EXPORT static void pin(unsigned int n);
+    /// Restore the processing units the process could run on at startup
+    GECODE_SUPPORT_EXPORT static void unpin(void);
   private:
     /// A thread cannot be copied
     Thread(const Thread&) {}
@@ -33,6 +33,13 @@
 
 #include <gecode/support.hh>
 
+#ifdef __linux__
+#include <cstdio>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <vector>
+#endif
+
 namespace Gecode { namespace Support {
 
   /*
@@ -46,6 +53,16 @@ namespace Gecode { namespace Support {
 
   Thread::Run* Thread::idle = NULL;
 
+  unsigned int
+  Thread::pooled(void) {
+    unsigned int n = 0U;
+    m()->acquire();
+    for (Run* r = idle; r != NULL; r = r->n)
+      n++;
+    m()->release();
+    return n;
+  }
+
   void
   Thread::Run::exec(void) {
     while (true) {
@@ -74,6 +91,132 @@ namespace Gecode { namespace Support {
     }
   }
 
+
+  /*
+   * NUMA support
+   *
+   */
+
+#ifdef __linux__
+
+  /**
+   * \brief Read list of the form 0-3,8,10-11 from file \a fn
+   *
+   * Calls \a f for each element of the list and returns whether the
+   * file could be read.
+   */
+  template<class F>
+  static bool
+  readlist(const char* fn, F f) {
+    std::FILE* fp = std::fopen(fn, "r");
+    if (fp == NULL)
+      return false;
+    unsigned int l, u;
+    while (std::fscanf(fp, "%u", &l) == 1) {
+      u = l;
+      int c = std::fgetc(fp);
+      if ((c == '-') && (std::fscanf(fp, "%u", &u) == 1))
+        c = std::fgetc(fp);
+      for (unsigned int i=l; i<=u; i++)
+        f(i);
+      if (c != ',')
+        break;
+    }
+    std::fclose(fp);
+    return true;
+  }
+
+  /// Information on NUMA nodes, read once
+  class NUMAInfo {
+  public:
+    /// Identifiers of the online NUMA nodes
+    std::vector<unsigned int> ids;
+    /// Affinity of the process at startup
+    cpu_set_t affinity;
+    /// Whether the affinity at startup is known
+    bool has_affinity;
+    /// Initialize
+    NUMAInfo(void) {
+      has_affinity = (sched_getaffinity(0, sizeof(affinity), &affinity) == 0);
+      (void) readlist("/sys/devices/system/node/online",
+                      [this](unsigned int i) { ids.push_back(i); });
+      if (ids.empty())
+        ids.push_back(0U);
+    }
+  };
+
+  /// Return NUMA information (initialized thread-safe on first use)
+  static const NUMAInfo&
+  numa(void) {
+    static NUMAInfo ni;
+    return ni;
+  }
+
+  /// Make sure that the affinity is recorded before threads are pinned
+  static const NUMAInfo& numa_startup = numa();
+
+  unsigned int
+  Thread::nodes(void) {
+    return static_cast<unsigned int>(numa().ids.size());
+  }
+
+  unsigned int
+  Thread::node(void) {
+#ifdef SYS_getcpu
+    unsigned int c, n;
+    if (syscall(SYS_getcpu, &c, &n, NULL) == 0)
+      return n;
+#endif
+    return 0U;
+  }
+
+  void
+  Thread::pin(unsigned int n) {
+    const NUMAInfo& ni = numa();
+    char fn[64];
+    (void) snprintf(fn, sizeof(fn), "/sys/devices/system/node/node%u/cpulist",
+                    ni.ids[n % ni.ids.size()]);
+    cpu_set_t cs;
+    CPU_ZERO(&cs);
+    if (!readlist(fn, [&cs](unsigned int i) {
+          if (i < CPU_SETSIZE)
+            CPU_SET(i, &cs);
+        }))
+      return;
+    // Never use processing units outside the original affinity
+    if (ni.has_affinity)
+      CPU_AND(&cs, &cs, &ni.affinity);
+    if (CPU_COUNT(&cs) > 0)
+      (void) sched_setaffinity(0, sizeof(cs), &cs);
+  }
+
+  void
+  Thread::unpin(void) {
+    const NUMAInfo& ni = numa();
+    if (ni.has_affinity)
+      (void) sched_setaffinity(0, sizeof(ni.affinity), &ni.affinity);
+  }
+
+#else
+
+  unsigned int
+  Thread::nodes(void) {
+    return 1U;
+  }
+
+  unsigned int
+  Thread::node(void) {
+    return 0U;
+  }
+
+  void
+  Thread::pin(unsigned int) {}
+
+  void
+  Thread::unpin(void) {}
+
+#endif
+
 }}
 
 // STATISTICS: support-any
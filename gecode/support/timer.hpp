@@ -62,6 +62,16 @@ namespace Gecode { namespace Support {
     double stop(void);
   };
 
+  /** \brief Return current value of a fine-grained cycle counter
+   *
+   * On x86 this is the time stamp counter, otherwise a monotonic
+   * clock in nanoseconds. Only differences between two values are
+   * meaningful.
+   *
+   * \ingroup FuncSupport
+   */
+  GECODE_SUPPORT_EXPORT unsigned long long int ticks(void);
+
   inline void
   Timer::start(void) {
 #if   defined(GECODE_USE_GETTIMEOFDAY)
@@ -54,10 +54,12 @@ namespace Test {
       std::string _source;
       std::string _expected;
       bool _allSolutions;
+      std::string _tableCache;
     public:
-      /// Construct and register test
+      /// Construct and register test (using table cache directory \a tableCache if not empty)
       FlatZincTest(const std::string& name, const std::string& source,
-                   const std::string& expected, bool allSolutions = false);
+                   const std::string& expected, bool allSolutions = false,
+                   const std::string& tableCache = "");
       /// Perform test
       virtual bool run(void);
     };
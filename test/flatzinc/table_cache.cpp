@@ -0,0 +1,86 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test/flatzinc.hh"
+
+#include <cstdlib>
+
+namespace Test { namespace FlatZinc {
+
+  namespace {
+    /// Helper class to create and register tests
+    class Create {
+    public:
+
+      /// Perform creation and registration
+      Create(void) {
+#ifdef _WIN32
+        const char* d = std::getenv("TEMP");
+#else
+        const char* d = std::getenv("TMPDIR");
+        if (d == NULL)
+          d = "/tmp";
+#endif
+        if (d == NULL)
+          d = ".";
+        std::string s = "\
+predicate gecode_table_int(array [int] of var int: x, array [int] of int: t);\n\
+predicate gecode_regular(array [int] of var int: x, int: Q, int: S, array [int] of int: d, int: q0, set of int: F);\n\
+var 1..3: x1 :: output_var;\n\
+var 1..3: x2 :: output_var;\n\
+var 1..3: x3 :: output_var;\n\
+constraint gecode_table_int([x1, x2, x3], [1, 2, 3, 2, 3, 1, 3, 1, 2, 3, 3, 3]);\n\
+constraint gecode_regular([x1, x2, x3], 4, 3, [1, 2, 3, 0, 2, 3, 0, 0, 3, 1, 2, 3], 4, 1..3);\n\
+solve satisfy;\n\
+";
+        std::string e = "\
+x1 = 1;\n\
+x2 = 2;\n\
+x3 = 3;\n\
+----------\n\
+x1 = 3;\n\
+x2 = 3;\n\
+x3 = 3;\n\
+----------\n\
+==========\n\
+";
+        // The first run fills the cache, the second one uses it
+        (void) new FlatZincTest("table_cache::none",s,e,true);
+        (void) new FlatZincTest("table_cache::fill",s,e,true,d);
+        (void) new FlatZincTest("table_cache::use",s,e,true,d);
+        // Entries that cannot be written are ignored
+        (void) new FlatZincTest("table_cache::missing",s,e,true,
+                                std::string(d) + "/gecode-no-such-dir");
+      }
+    };
+
+    Create c;
+  }
+
+}}
+
+// STATISTICS: test-flatzinc
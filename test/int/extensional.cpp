@@ -39,6 +39,10 @@
 
 #include <gecode/minimodel.hh>
 #include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
 
 namespace Test { namespace Int {
 
@@ -500,6 +504,37 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test with tuple set using a given instruction set extension
+     class TupleSetSIMD : public TupleSetTest {
+     protected:
+       /// Instruction set extension to use
+       Gecode::Support::SIMD l;
+       /// Return name of instruction set extension \a l
+       static std::string str(Gecode::Support::SIMD l) {
+         switch (l) {
+         case Gecode::Support::SIMD_AVX512: return "AVX512";
+         case Gecode::Support::SIMD_AVX2:   return "AVX2";
+         default:                           return "None";
+         }
+       }
+     public:
+       /// Create and register test
+       TupleSetSIMD(bool p, Gecode::IntSet d0, Gecode::TupleSet ts0,
+                    Gecode::Support::SIMD l0)
+         : TupleSetTest("SIMD::"+str(l0),p,d0,ts0,false), l(l0) {
+         testsearch = false;
+       }
+       /// Run test with instruction set extension restricted to \a l
+       virtual bool run(void) {
+         using namespace Gecode;
+         Support::SIMD o = Support::simd();
+         Support::simd(l);
+         bool r = TupleSetTest::run();
+         Support::simd(o);
+         return r;
+       }
+     };
+
      /// %Test with large tuple set
      class TupleSetLarge : public Test {
      protected:
@@ -609,6 +644,98 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for saving tuple sets to and loading them from files
+     class TupleSetFile : public Base {
+     protected:
+       /// Whether to test malformed files
+       bool invalid;
+       /// Return name of a temporary file
+       static std::string tmp(void) {
+#ifdef _WIN32
+         const char* d = std::getenv("TEMP");
+#else
+         const char* d = std::getenv("TMPDIR");
+         if (d == NULL)
+           d = "/tmp";
+#endif
+         if (d == NULL)
+           d = ".";
+         return std::string(d) + "/gecode-test-tuple-set-" +
+           std::to_string(Base::rand(1000000U)) + ".bin";
+       }
+       /// Write \a n bytes of \a b to file \a fn
+       static void write(const std::string& fn, const std::string& b,
+                         std::size_t n) {
+         std::ofstream f(fn.c_str(), std::ios::out | std::ios::binary |
+                         std::ios::trunc);
+         f.write(b.data(), static_cast<std::streamsize>(n));
+       }
+       /// Test whether loading file \a fn fails
+       static bool fails(const std::string& fn) {
+         try {
+           Gecode::TupleSet l(fn);
+         } catch (Gecode::Int::InvalidTupleSetFile&) {
+           return true;
+         }
+         return false;
+       }
+     public:
+       /// Create and register test
+       TupleSetFile(bool i)
+         : Base(std::string("Int::Extensional::TupleSet::File::") +
+                (i ? "Invalid" : "Valid")), invalid(i) {}
+       /// Run test
+       virtual bool run(void) {
+         using namespace Gecode;
+         TupleSet t(6);
+         CpltAssignment ass(6, IntSet(0, 3));
+         while (ass()) {
+           if (Base::rand(100) <= 0.2*100) {
+             IntArgs tuple(6);
+             for (int i = 6; i--; ) tuple[i] = ass[i];
+             t.add(tuple);
+           }
+           ++ass;
+         }
+         t.finalize();
+         std::string fn = tmp();
+         t.save(fn);
+         bool ok;
+         if (!invalid) {
+           TupleSet l(fn);
+           ok = (t == l);
+         } else {
+           std::string b;
+           {
+             std::ifstream f(fn.c_str(), std::ios::in | std::ios::binary);
+             b.assign(std::istreambuf_iterator<char>(f),
+                      std::istreambuf_iterator<char>());
+           }
+           // Truncated file
+           write(fn,b,b.size()-8U);
+           ok = fails(fn);
+           // Truncated header
+           write(fn,b,8U);
+           ok = ok && fails(fn);
+           // Last value of last tuple out of range (the tuples are
+           // followed by the support words for all 6*4 values)
+           std::string c(b);
+           std::size_t o = c.size() - sizeof(int) -
+             t.words() * 6U * 4U * sizeof(Support::BitSetData);
+           int v = 4;
+           c.replace(o, sizeof(int),
+                     reinterpret_cast<const char*>(&v), sizeof(int));
+           write(fn,c,c.size());
+           ok = ok && fails(fn);
+           // Missing file
+           (void) std::remove(fn.c_str());
+           ok = ok && fails(fn);
+         }
+         (void) std::remove(fn.c_str());
+         return ok;
+       }
+     };
+
      /// Help class to create and register tests with a fixed table size
      class TupleSetTestSize {
      public:
@@ -785,6 +912,26 @@ namespace Test { namespace Int {
              t.finalize();
              (void) new RandomTupleSetTest("FewHuge",pos,IntSet(1,4),t);
            }
+           {
+             // At least 16 words, such that vectorized operations are used
+             TupleSet t(4);
+             CpltAssignment ass(4, IntSet(0, 7));
+             while (ass()) {
+               if (Base::rand(100) <= 0.4*100) {
+                 IntArgs tuple(4);
+                 for (int i = 4; i--; ) tuple[i] = ass[i];
+                 t.add(tuple);
+               }
+               ++ass;
+             }
+             t.finalize();
+             (void) new TupleSetSIMD(pos,IntSet(0,7),t,
+                                     Support::SIMD_NONE);
+             (void) new TupleSetSIMD(pos,IntSet(0,7),t,
+                                     Support::SIMD_AVX2);
+             (void) new TupleSetSIMD(pos,IntSet(0,7),t,
+                                     Support::SIMD_AVX512);
+           }
            (void) new TupleSetBase(pos);
            (void) new TupleSetLarge(0.05,pos);
            (void) new TupleSetBool(0.3,pos);
@@ -794,6 +941,9 @@ namespace Test { namespace Int {
      
      Create c;
 
+     TupleSetFile tsfv(false);
+     TupleSetFile tsfi(true);
+
      RegSimpleA ra;
      RegSimpleB rb;
      RegSimpleC rc;
@@ -98,6 +98,22 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test linear relation over many integer variables
+     class IntIntMany : public IntInt {
+     public:
+       /// Create and register test
+       IntIntMany(const std::string& s, const Gecode::IntSet& d,
+                  const Gecode::IntArgs& a0, Gecode::IntRelType irt0,
+                  int c0)
+         : IntInt(s,d,a0,irt0,c0) {
+         testsearch = false;
+       }
+       /// Create random assignment
+       virtual Assignment* assignment(void) const {
+         return new RandomAssignment(arity,dom,200);
+       }
+     };
+
      /// %Test linear relation over integer variables
      class IntVar : public Test {
      protected:
@@ -333,6 +349,30 @@ namespace Test { namespace Int {
              }
            }
          }
+         {
+           // Enough views for the incremental propagators
+           const int n = 32;
+           IntArgs a1(n), a2(n), a3(n);
+           for (int i=0; i<n; i++) {
+             a1[i] = 1;
+             a2[i] = (i % 3 == 0) ? -1 : 1;
+             a3[i] = ((i % 2 == 0) ? 1 : -1) * (i % 5 + 1);
+           }
+           IntSet d1(-2,2);
+           const int dv2[] = {-4,-1,0,1,4};
+           IntSet d2(dv2,5);
+           const int dv3[] = {0,1500000000};
+           IntSet d3(dv3,2);
+           for (IntRelTypes irts; irts(); ++irts) {
+             (void) new IntIntMany("12",d1,a1,irts.irt(),0);
+             (void) new IntIntMany("13",d1,a2,irts.irt(),3);
+             (void) new IntIntMany("14",d1,a3,irts.irt(),-2);
+             (void) new IntIntMany("22",d2,a1,irts.irt(),1);
+             (void) new IntIntMany("23",d2,a2,irts.irt(),0);
+             (void) new IntIntMany("24",d2,a3,irts.irt(),5);
+             (void) new IntIntMany("32",d3,a1,irts.irt(),1500000000);
+           }
+         }
          {
            const int av1[10] = {
              1, 1, 1, 1, 1, 1, 1, 1, 1, 1
@@ -0,0 +1,127 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int.hh>
+
+#include "test/test.hh"
+
+#include <sstream>
+#include <string>
+
+namespace Test {
+
+  /// %Test for propagator profiler
+  namespace Profiler {
+
+    /// Space with a chain of less-than constraints
+    class Chain : public Gecode::Space {
+    public:
+      /// Variables
+      Gecode::IntVarArray x;
+      /// Initialize with \a n variables
+      Chain(int n) : x(*this,n,0,n) {
+        for (int i=0; i<n-1; i++)
+          Gecode::rel(*this, x[i], Gecode::IRT_LE, x[i+1]);
+      }
+      /// Constructor for cloning \a s
+      Chain(Chain& s) : Gecode::Space(s) {
+        x.update(*this, s.x);
+      }
+      /// Copy during cloning
+      virtual Gecode::Space* copy(void) {
+        return new Chain(*this);
+      }
+    };
+
+    /// Return sum of all numbers following \a k in \a s
+    unsigned long int
+    sum(const std::string& s, const std::string& k) {
+      unsigned long int n = 0;
+      std::string::size_type i = 0;
+      while ((i = s.find(k,i)) != std::string::npos) {
+        i += k.size();
+        n += std::stoul(s.substr(i));
+      }
+      return n;
+    }
+
+    /// %Test that all propagator executions are recorded
+    class Calls : public Test::Base {
+    public:
+      /// Initialize test
+      Calls(void) : Test::Base("Profiler::Calls") {}
+      /// Perform actual tests
+      bool run(void) {
+        Gecode::PropagatorProfiler p;
+        Chain* c = new Chain(10);
+        c->profile(p);
+        Gecode::StatusStatistics stat;
+        if (c->status(stat) != Gecode::SS_SOLVED) {
+          delete c; return false;
+        }
+        // The clone must record into the same profiler
+        Chain* d = static_cast<Chain*>(c->clone());
+        Gecode::rel(*d, d->x[0], Gecode::IRT_GR, 0);
+        if (d->status(stat) != Gecode::SS_SOLVED) {
+          delete c; delete d; return false;
+        }
+        delete c; delete d;
+        // Comma-separated values: calls are the third field
+        std::ostringstream csv;
+        p.csv(csv);
+        std::string l;
+        std::istringstream is(csv.str());
+        std::getline(is,l);
+        if (l.compare(0,22,"propagator,group,calls") != 0)
+          return false;
+        unsigned long int n = 0;
+        bool rel = false;
+        while (std::getline(is,l)) {
+          std::string::size_type q = l.rfind('"');
+          if (q == std::string::npos)
+            return false;
+          rel |= (l.find("Rel::Le") != std::string::npos);
+          std::string::size_type f = l.find(',',q+2);
+          n += std::stoul(l.substr(f+1));
+        }
+        if (!rel || (n != stat.propagate))
+          return false;
+        // JSON
+        std::ostringstream json;
+        p.json(json);
+        return ((json.str().find("Rel::Le") != std::string::npos) &&
+                (sum(json.str(),"\"calls\": ") == stat.propagate));
+      }
+    };
+
+    Calls calls;
+
+  }
+
+}
+
+// STATISTICS: test-core
@@ -308,6 +308,51 @@ namespace Test {
       }
     };
 
+    /// Space for best solution search with many improving solutions
+    class Optimize : public TestSpace {
+    public:
+      /// Variables used
+      IntVarArray x;
+      /// Objective
+      IntVar o;
+      /// Constructor for space creation
+      Optimize(HowToBranch, HowToBranch, HowToBranch,
+               HowToConstrain=HTC_NONE)
+        : x(*this,7,0,6), o(*this,0,Int::Limits::max) {
+        distinct(*this, x);
+        linear(*this, IntArgs::create(7,1), x, IRT_EQ, o);
+        // Smallest values first yields many improving solutions
+        Gecode::branch(*this, x, INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      Optimize(Optimize& s) : TestSpace(s) {
+        x.update(*this, s.x);
+        o.update(*this, s.o);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new Optimize(*this);
+      }
+      /// Add constraint for next better solution
+      virtual void constrain(const Space& _s) {
+        const Optimize& s = static_cast<const Optimize&>(_s);
+        rel(*this, o, IRT_GR, s.o.val());
+      }
+      /// Return number of solutions
+      virtual int solutions(void) const {
+        return 5040;
+      }
+      /// Verify that this is best solution
+      virtual bool best(void) const {
+        // Largest values for largest coefficients: sum of i*(i-1)
+        return o.val() == 112;
+      }
+      /// Return name
+      static std::string name(void) {
+        return "Opt";
+      }
+    };
+
     /// %Base class for search tests
     class Test : public Base {
     public:
@@ -364,14 +409,20 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Whether to use work stealing
+      bool ws;
+      /// Number of worker processes
+      unsigned int p;
     public:
       /// Initialize test
       DFS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          bool ws0=false, unsigned int p0=0)
         : Test("DFS::"+Model::name()+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+(ws0 ? "::WS" : "")+
+               (p0 > 0 ? "::P"+str(p0) : ""),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0), ws(ws0), p(p0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3);
@@ -380,6 +431,8 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.work_stealing = ws;
+        o.processes = p;
         o.stop = &f;
         Gecode::DFS<Model> dfs(m,o);
         int n = m->solutions();
@@ -397,6 +450,78 @@ namespace Test {
       }
     };
 
+    /// %Test for parallel depth-first search with NUMA-aware memory
+    template<class Model>
+    class NUMA : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+      /// Whether to use work stealing
+      bool ws;
+    public:
+      /// Initialize test
+      NUMA(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+           unsigned int t0, bool ws0)
+        : Test("NUMA::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(t0)+(ws0 ? "::WS" : ""),
+               htb1,htb2,htb3), t(t0), ws(ws0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.work_stealing = ws;
+        o.numa = true;
+        int n = m->solutions();
+        {
+          Gecode::DFS<Model> dfs(m,o);
+          while (Model* s = dfs.next()) {
+            n--; delete s;
+          }
+        }
+        // Only the threads of the engine cache memory per NUMA node
+        bool ok = (n == 0) && !Gecode::Kernel::SharedMemory::numa();
+        // The original space can still be used
+        ok = ok && (m->status() != Gecode::SS_FAILED);
+        delete m;
+        return ok;
+      }
+    };
+
+    /// %Test that scheduling by learned cost does not change search
+    template<class Model>
+    class Feedback : public Test {
+    public:
+      /// Initialize test
+      Feedback(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3)
+        : Test("Feedback::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3),
+               htb1,htb2,htb3) {}
+      /// Explore all solutions with feedback \a fb, return number of solutions
+      int solve(bool fb, Gecode::Search::Statistics& stat) {
+        Model* m = new Model(htb1,htb2,htb3);
+        m->feedback(fb);
+        Gecode::DFS<Model> dfs(m);
+        delete m;
+        int n = 0;
+        while (Model* s = dfs.next()) {
+          n++; delete s;
+        }
+        stat = dfs.statistics();
+        return n;
+      }
+      /// Run test
+      virtual bool run(void) {
+        Gecode::Search::Statistics s, f;
+        int n_s = solve(false,s);
+        int n_f = solve(true,f);
+        Model m(htb1,htb2,htb3);
+        return ((n_s == m.solutions()) && (n_f == n_s) &&
+                (f.node == s.node) && (f.fail == s.fail));
+      }
+    };
+
     /// %Test for limited discrepancy search
     template<class Model>
     class LDS : public Test {
@@ -444,15 +569,21 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Whether to use work stealing
+      bool ws;
+      /// Number of worker processes
+      unsigned int p;
     public:
       /// Initialize test
       BAB(HowToConstrain htc,
           HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          bool ws0=false, unsigned int p0=0)
         : Test("BAB::"+Model::name()+"::"+str(htc)+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+(ws0 ? "::WS" : "")+
+               (p0 > 0 ? "::P"+str(p0) : ""),
+               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0), ws(ws0), p(p0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3,htc);
@@ -461,6 +592,8 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.work_stealing = ws;
+        o.processes = p;
         o.stop = &f;
         Gecode::BAB<Model> bab(m,o);
         delete m;
@@ -647,6 +780,78 @@ namespace Test {
       }
     };
 
+    /// Model that posts no-goods when restarting
+    template<class Model>
+    class PostNoGoods : public Model {
+    public:
+      /// Constructor for space creation
+      PostNoGoods(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+                  HowToConstrain htc=HTC_NONE)
+        : Model(htb1,htb2,htb3,htc) {}
+      /// Constructor for cloning \a s
+      PostNoGoods(PostNoGoods& s) : Model(s) {}
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new PostNoGoods(*this);
+      }
+      /// Master configuration function that restarts and posts no-goods
+      virtual bool master(const MetaInfo& mi) {
+        if (mi.type() == MetaInfo::RESTART) {
+          if (mi.last() != NULL)
+            this->constrain(*mi.last());
+          mi.nogoods().post(*this);
+          return true;
+        } else {
+          // Keep the branchers so that no-goods can be exchanged
+          return false;
+        }
+      }
+    };
+
+    /// %Test for exchanging no-goods between assets of a portfolio
+    template<class Model>
+    class Exchange : public Test {
+    private:
+      /// How to constrain
+      HowToConstrain htc;
+      /// Number of master threads
+      unsigned int mt;
+    public:
+      /// Initialize test
+      Exchange(HowToConstrain htc0, unsigned int mt0)
+        : Test("PBS::Exchange::"+Model::name()+"::"+str(htc0)+"::"+str(mt0),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), htc(htc0), mt(mt0) {}
+      /// Run test
+      virtual bool run(void) {
+        using namespace Gecode;
+        typedef PostNoGoods<Model> Restart;
+        Restart* m = new Restart(htb1,htb2,htb3,htc);
+        Gecode::Search::Exchange x;
+
+        Gecode::Search::Options mo;
+        mo.threads = mt;
+
+        SEBs sebs(3);
+        for (int i=0; i<3; i++) {
+          Gecode::Search::Options so;
+          so.cutoff = Gecode::Search::Cutoff::geometric(1,2);
+          so.nogoods_limit = Gecode::Search::Config::nogoods_limit;
+          so.exchange = &x;
+          sebs[i] = rbs<Restart,Gecode::BAB>(so);
+        }
+        Gecode::PBS<Restart,Gecode::BAB> pbs(m, sebs, mo);
+        delete m;
+
+        Restart* b = NULL;
+        while (Restart* s = pbs.next()) {
+          delete b; b=s;
+        }
+        bool ok = (b != NULL) && b->best();
+        delete b;
+        return ok;
+      }
+    };
+
     /// Iterator for branching types
     class BranchTypes {
     private:
@@ -723,6 +928,42 @@ namespace Test {
                                     c_d, a_d, t);
             }
 
+        // Depth-first search with work stealing
+        for (unsigned int t = 2; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<10; c_d += 4)
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3)
+                  (void) new DFS<HasSolutions>
+                    (htb1.htb(),htb2.htb(),htb3.htb(),c_d,1,t,true);
+
+        // Depth-first search with worker processes
+        for (unsigned int p = 1; p<=3; p += 2)
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3)
+                (void) new DFS<HasSolutions>
+                  (htb1.htb(),htb2.htb(),htb3.htb(),1,1,1,false,p);
+
+        // Depth-first search with NUMA-aware memory
+        for (unsigned int t = 2; t<=4; t += 2)
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3) {
+                (void) new NUMA<HasSolutions>
+                  (htb1.htb(),htb2.htb(),htb3.htb(),t,false);
+                (void) new NUMA<HasSolutions>
+                  (htb1.htb(),htb2.htb(),htb3.htb(),t,true);
+              }
+
+        // Depth-first search with propagators scheduled by learned cost
+        for (BranchTypes htb1; htb1(); ++htb1)
+          for (BranchTypes htb2; htb2(); ++htb2)
+            for (BranchTypes htb3; htb3(); ++htb3)
+              (void) new Feedback<HasSolutions>
+                (htb1.htb(),htb2.htb(),htb3.htb());
+        (void) new Feedback<Optimize>(HTB_BINARY,HTB_BINARY,HTB_BINARY);
+
         // Limited discrepancy search
         for (unsigned int t = 1; t<=4; t++) {
           for (BranchTypes htb1; htb1(); ++htb1)
@@ -753,6 +994,30 @@ namespace Test {
               (void) new BAB<HasSolutions>
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
+
+        // Best solution search with work stealing
+        for (unsigned int t = 2; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<10; c_d += 4)
+            for (ConstrainTypes htc; htc(); ++htc)
+              for (BranchTypes htb1; htb1(); ++htb1)
+                for (BranchTypes htb2; htb2(); ++htb2)
+                  for (BranchTypes htb3; htb3(); ++htb3)
+                    (void) new BAB<HasSolutions>
+                      (htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
+                       c_d,1,t,true);
+        for (unsigned int t = 1; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<10; c_d += 4)
+            (void) new BAB<Optimize>
+              (HTC_NONE,HTB_BINARY,HTB_BINARY,HTB_BINARY,c_d,1,t,t > 1);
+        // Best solution search with worker processes
+        for (unsigned int p = 1; p<=3; p += 2)
+          for (ConstrainTypes htc; htc(); ++htc)
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3)
+                  (void) new BAB<HasSolutions>
+                    (htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
+                     1,1,1,false,p);
         // Restart-based search
         for (unsigned int t=1; t<=4; t++) {
           (void) new RBS<HasSolutions,Gecode::DFS>("DFS",t);
@@ -788,6 +1053,10 @@ namespace Test {
             (void) new SEBPBS<FailImmediate>("DFS+LDS",false,mt,st);
             (void) new SEBPBS<SolveImmediate>("DFS+LDS",false,mt,st);
           }
+        // Portfolio-based search exchanging no-goods
+        for (unsigned int mt=1; mt<=3; mt += 2)
+          for (ConstrainTypes htc; htc(); ++htc)
+            (void) new Exchange<HasSolutions>(htc.htc(),mt);
       }
     };
 
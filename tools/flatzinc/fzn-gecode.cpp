@@ -58,10 +58,14 @@ int main(int argc, char** argv) {
   FlatZinc::FlatZincSpace* fg = NULL;
   Rnd rnd(opt.seed());
   try {
+    if (opt.table_cache() != NULL) {
+      fg = new FlatZinc::FlatZincSpace(rnd);
+      fg->tableCache(opt.table_cache());
+    }
     if (!strcmp(filename, "-")) {
-      fg = FlatZinc::parse(cin, p, std::cerr, NULL, rnd);
+      fg = FlatZinc::parse(cin, p, std::cerr, fg, rnd);
     } else {
-      fg = FlatZinc::parse(filename, p, std::cerr, NULL, rnd);
+      fg = FlatZinc::parse(filename, p, std::cerr, fg, rnd);
     }
 
     if (fg) {